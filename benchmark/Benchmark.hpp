@@ -0,0 +1,162 @@
+/**
+ * Benchmark runner.
+ *
+ * A benchmark is a function object, which performs some operations on a data set
+ * of a passed size and returns the number of the operations. The function starts
+ * and stops a passed stopwatch around the measured operations, so that preparing
+ * of the data set is not measured. The runner calls the function repeatedly until
+ * a minimum time elapses, and prints the best time of one operation as a line
+ * of JSON, for example:
+ *
+ * {"benchmark":"LinkedList.add","size":256,"repeats":5,"operations":1280,"ns_per_op":12.5}
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef BENCHMARK_BENCHMARK_HPP_
+#define BENCHMARK_BENCHMARK_HPP_
+
+#include "Types.hpp"
+#include <stdio.h>
+#include <time.h>
+
+namespace local
+{
+    namespace benchmark
+    {
+        class Benchmark
+        {
+
+        public:
+
+            /**
+             * Stopwatch of measured operations.
+             */
+            class Stopwatch
+            {
+
+            public:
+
+                /**
+                 * Constructor.
+                 */
+                Stopwatch() :
+                    start_ (0),
+                    time_  (0){
+                }
+
+                /**
+                 * Starts measuring.
+                 */
+                void start()
+                {
+                    start_ = getTime();
+                }
+
+                /**
+                 * Stops measuring and accumulates the measured time.
+                 */
+                void stop()
+                {
+                    time_ += getTime() - start_;
+                }
+
+                /**
+                 * Returns the measured time.
+                 *
+                 * @return the time in nanoseconds.
+                 */
+                int64 getElapsed() const
+                {
+                    return time_;
+                }
+
+            private:
+
+                /**
+                 * Time of starting measuring.
+                 */
+                int64 start_;
+
+                /**
+                 * Measured time.
+                 */
+                int64 time_;
+
+            };
+
+            /**
+             * Runs a benchmark.
+             *
+             * @param name     a name of the benchmark.
+             * @param size     a size of the data set.
+             * @param function a benchmark function object, which has
+             *                 int64 operator()(int32 size, Stopwatch& watch) method.
+             */
+            template <class F>
+            static void run(const char* const name, const int32 size, F function)
+            {
+                double best = 0.0;
+                int64 total = 0;
+                int32 repeats = 0;
+                const int64 begin = getTime();
+                while(repeats < MIN_REPEATS || getTime() - begin < MIN_TIME)
+                {
+                    Stopwatch watch;
+                    const int64 operations = function(size, watch);
+                    if(operations > 0)
+                    {
+                        const double perOperation = static_cast<double>( watch.getElapsed() ) / static_cast<double>(operations);
+                        if(total == 0 || perOperation < best)
+                        {
+                            best = perOperation;
+                        }
+                        total += operations;
+                    }
+                    repeats++;
+                }
+                ::printf("{\"benchmark\":\"%s\",\"size\":%d,\"repeats\":%d,\"operations\":%lld,\"ns_per_op\":%.3f}\n",
+                    name, size, repeats, static_cast<long long>(total), best);
+            }
+
+            /**
+             * Keeps a value from being optimized away.
+             *
+             * @param value a value calculated by a benchmark.
+             */
+            template <typename T>
+            static void keep(const T& value)
+            {
+                static volatile int64 sink = 0;
+                sink = sink + static_cast<int64>(value);
+            }
+
+            /**
+             * Returns a monotonic time.
+             *
+             * @return the time in nanoseconds.
+             */
+            static int64 getTime()
+            {
+                struct timespec ts;
+                ::clock_gettime(CLOCK_MONOTONIC, &ts);
+                return static_cast<int64>(ts.tv_sec) * 1000000000LL + static_cast<int64>(ts.tv_nsec);
+            }
+
+        private:
+
+            /**
+             * Minimum number of calls of a benchmark function.
+             */
+            static const int32 MIN_REPEATS = 5;
+
+            /**
+             * Minimum time of running a benchmark in nanoseconds.
+             */
+            static const int64 MIN_TIME = 20000000LL;
+
+        };
+    }
+}
+#endif // BENCHMARK_BENCHMARK_HPP_
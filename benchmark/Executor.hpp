@@ -0,0 +1,251 @@
+/**
+ * Executor of tasks by a fixed number of host threads.
+ *
+ * Each worker thread has a work-stealing deque, a task spawns new tasks to
+ * the deque of its worker, and a worker with the empty deque steals tasks
+ * of other workers. If the executor is shared, all the workers use one deque
+ * guarded by a mutex instead, which is the shared queue the deques are
+ * compared with.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef BENCHMARK_EXECUTOR_HPP_
+#define BENCHMARK_EXECUTOR_HPP_
+
+#include "library.WorkStealingDeque.hpp"
+#include <pthread.h>
+#include <sched.h>
+
+namespace local
+{
+    namespace benchmark
+    {
+        class Executor
+        {
+
+        public:
+
+            /**
+             * Task executed by a worker.
+             */
+            class Task
+            {
+
+            public:
+
+                /**
+                 * Executes this task.
+                 *
+                 * @param executor - the executor.
+                 * @param worker   - an index of the worker executing the task.
+                 */
+                virtual void execute(Executor& executor, int32 worker) = 0;
+
+            protected:
+
+                /**
+                 * Destructor.
+                 */
+               ~Task()
+                {
+                }
+
+            };
+
+            /**
+             * Maximum number of worker threads.
+             */
+            static const int32 MAX_THREADS = 16;
+
+            /**
+             * Constructor.
+             *
+             * @param threads - a number of worker threads.
+             * @param shared  - true if the workers use one shared queue.
+             */
+            Executor(int32 const threads, bool const shared) :
+                threads_ (threads < MAX_THREADS ? threads : MAX_THREADS),
+                shared_  (shared),
+                pending_ (0){
+                static_cast<void>( ::pthread_mutex_init(&mutex_, NULL) );
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Executor()
+            {
+                static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+            }
+
+            /**
+             * Spawns a task.
+             *
+             * The function is called by a task for its worker,
+             * or by the run function for the first worker. If the task
+             * cannot be pushed to a deque, it is executed in place.
+             *
+             * @param worker - an index of the worker executing the calling task.
+             * @param task   - a task to spawn.
+             */
+            void spawn(int32 const worker, Task* const task)
+            {
+                bool isPushed;
+                static_cast<void>( pending_.fetchAdd(1, library::AtomicBase::RELAXED) );
+                if(shared_)
+                {
+                    static_cast<void>( ::pthread_mutex_lock(&mutex_) );
+                    isPushed = deques_[0].push(task);
+                    static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+                }
+                else
+                {
+                    isPushed = deques_[worker].push(task);
+                }
+                // A task not pushed for lack of memory is executed by the spawning worker
+                if( not isPushed )
+                {
+                    task->execute(*this, worker);
+                    static_cast<void>( pending_.fetchSub(1, library::AtomicBase::RELEASE) );
+                }
+            }
+
+            /**
+             * Runs a task and all tasks spawned by it.
+             *
+             * @param task - the first task.
+             */
+            void run(Task* const task)
+            {
+                ::pthread_t threads[MAX_THREADS];
+                Argument arguments[MAX_THREADS];
+                spawn(0, task);
+                for(int32 i=0; i<threads_; i++)
+                {
+                    arguments[i].executor = this;
+                    arguments[i].worker = i;
+                    static_cast<void>( ::pthread_create(&threads[i], NULL, work, &arguments[i]) );
+                }
+                for(int32 i=0; i<threads_; i++)
+                {
+                    static_cast<void>( ::pthread_join(threads[i], NULL) );
+                }
+            }
+
+        private:
+
+            /**
+             * Argument of a worker thread.
+             */
+            struct Argument
+            {
+                Executor* executor;
+                int32 worker;
+            };
+
+            /**
+             * Executes tasks until all spawned tasks have been executed.
+             *
+             * @param arg - the worker argument.
+             * @return NULL.
+             */
+            static void* work(void* const arg)
+            {
+                Argument* const argument = reinterpret_cast<Argument*>(arg);
+                Executor& executor = *argument->executor;
+                int32 const worker = argument->worker;
+                uint32 victim = static_cast<uint32>(worker);
+                while( executor.pending_.load(library::AtomicBase::ACQUIRE) != 0 )
+                {
+                    Task* task = NULL;
+                    if( not executor.take(worker, victim, task) )
+                    {
+                        static_cast<void>( ::sched_yield() );
+                        continue;
+                    }
+                    task->execute(executor, worker);
+                    static_cast<void>( executor.pending_.fetchSub(1, library::AtomicBase::RELEASE) );
+                }
+                return NULL;
+            }
+
+            /**
+             * Takes a task for a worker.
+             *
+             * @param worker - an index of the worker.
+             * @param victim - a state of choosing workers to steal from.
+             * @param task   - a variable for the task.
+             * @return true if the task has been taken.
+             */
+            bool take(int32 const worker, uint32& victim, Task*& task)
+            {
+                bool res;
+                if(shared_)
+                {
+                    static_cast<void>( ::pthread_mutex_lock(&mutex_) );
+                    res = deques_[0].pop(task);
+                    static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+                }
+                else
+                {
+                    res = deques_[worker].pop(task);
+                    for(int32 i=1; i<threads_ && not res; i++)
+                    {
+                        // A linear congruential generator spreads thieves over the workers
+                        victim = victim * 1103515245U + 12345U;
+                        int32 const index = static_cast<int32>( (victim >> 16) % static_cast<uint32>(threads_) );
+                        if(index != worker)
+                        {
+                            res = deques_[index].steal(task);
+                        }
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            Executor(const Executor& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            Executor& operator=(const Executor& obj);
+
+            /**
+             * Number of the worker threads.
+             */
+            int32 threads_;
+
+            /**
+             * The workers use one shared queue.
+             */
+            bool shared_;
+
+            /**
+             * Number of spawned tasks which have not been executed.
+             */
+            library::Atomic<int32> pending_;
+
+            /**
+             * Mutex of the shared queue.
+             */
+            ::pthread_mutex_t mutex_;
+
+            /**
+             * Deques of the workers.
+             */
+            library::WorkStealingDeque<Task*> deques_[MAX_THREADS];
+
+        };
+    }
+}
+#endif // BENCHMARK_EXECUTOR_HPP_
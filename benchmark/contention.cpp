@@ -0,0 +1,170 @@
+/**
+ * Benchmarks of counters contended by threads.
+ *
+ * Each thread adds to its own counter or to one shared counter, and the size of
+ * a data set is a number of the threads. The counters of the threads are placed
+ * next to each other, aligned to cache lines, or sharded by the threads.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#include "Benchmark.hpp"
+#include "library.Atomic.hpp"
+#include "library.CacheAligned.hpp"
+#include "library.ShardedCounter.hpp"
+#include <pthread.h>
+
+namespace local
+{
+    namespace benchmark
+    {
+        typedef Benchmark::Stopwatch Stopwatch;
+
+        /**
+         * Maximum number of threads.
+         */
+        static const int32 THREADS = 8;
+
+        /**
+         * Number of additions of a thread.
+         */
+        static const int32 ADDITIONS = 1000000;
+
+        /**
+         * One counter of all threads.
+         */
+        struct SharedCounter
+        {
+            library::Atomic<uint64> counter;
+
+            void add(int32, uint64 const value)
+            {
+                static_cast<void>( counter.fetchAdd(value, library::AtomicBase::RELAXED) );
+            }
+        };
+
+        /**
+         * Counters of threads placed next to each other.
+         */
+        struct AdjacentCounters
+        {
+            library::Atomic<uint64> counters[THREADS];
+
+            void add(int32 const thread, uint64 const value)
+            {
+                static_cast<void>( counters[thread].fetchAdd(value, library::AtomicBase::RELAXED) );
+            }
+        };
+
+        /**
+         * Counters of threads aligned to cache lines.
+         */
+        struct AlignedCounters
+        {
+            library::CacheAligned< library::Atomic<uint64> > counters[THREADS];
+
+            void add(int32 const thread, uint64 const value)
+            {
+                static_cast<void>( counters[thread].get().fetchAdd(value, library::AtomicBase::RELAXED) );
+            }
+        };
+
+        /**
+         * One counter sharded by threads.
+         */
+        struct ShardedCounters
+        {
+            library::ShardedCounter<THREADS> counter;
+
+            void add(int32 const thread, uint64 const value)
+            {
+                counter.add(thread, value);
+            }
+        };
+
+        /**
+         * Adding to counters by threads.
+         */
+        template <class C>
+        struct CounterAdd
+        {
+
+            /**
+             * Argument of a thread.
+             */
+            struct Argument
+            {
+                C* counters;
+                int32 thread;
+            };
+
+            /**
+             * Adds to a counter of a thread.
+             *
+             * @param arg - the thread argument.
+             * @return NULL.
+             */
+            static void* add(void* const arg)
+            {
+                Argument* const argument = reinterpret_cast<Argument*>(arg);
+                for(int32 i=0; i<ADDITIONS; i++)
+                {
+                    argument->counters->add(argument->thread, 1);
+                }
+                return NULL;
+            }
+
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                C counters;
+                ::pthread_t threads[THREADS];
+                Argument arguments[THREADS];
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    arguments[i].counters = &counters;
+                    arguments[i].thread = i;
+                    static_cast<void>( ::pthread_create(&threads[i], NULL, add, &arguments[i]) );
+                }
+                for(int32 i=0; i<size; i++)
+                {
+                    static_cast<void>( ::pthread_join(threads[i], NULL) );
+                }
+                watch.stop();
+                return static_cast<int64>(ADDITIONS) * size;
+            }
+        };
+
+        /**
+         * Numbers of threads.
+         */
+        static const int32 SIZES[] = {1, 2, 4, THREADS};
+
+        /**
+         * Runs all benchmarks.
+         */
+        static void run()
+        {
+            for(uint32 i=0; i<sizeof(SIZES) / sizeof(SIZES[0]); i++)
+            {
+                const int32 size = SIZES[i];
+                Benchmark::run("Counter.shared", size, CounterAdd<SharedCounter>());
+                Benchmark::run("Counter.adjacent", size, CounterAdd<AdjacentCounters>());
+                Benchmark::run("Counter.aligned", size, CounterAdd<AlignedCounters>());
+                Benchmark::run("Counter.sharded", size, CounterAdd<ShardedCounters>());
+            }
+        }
+    }
+}
+
+/**
+ * The main function.
+ *
+ * @return error code or zero.
+ */
+int main()
+{
+    ::local::benchmark::run();
+    return 0;
+}
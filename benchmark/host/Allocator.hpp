@@ -0,0 +1,49 @@
+/**
+ * Heap memory allocator.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ * Memory is allocated by the global operators new and delete, so that a host
+ * program replacing the operators allocates the library objects by them too.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef ALLOCATOR_HPP_
+#define ALLOCATOR_HPP_
+
+#include "Types.hpp"
+#include <new>
+
+namespace local
+{
+    class Allocator
+    {
+
+    public:
+
+        /**
+         * Allocates memory.
+         *
+         * @param size number of bytes to allocate.
+         * @return allocated memory address or a null pointer.
+         */
+        static void* allocate(size_t size)
+        {
+            return ::operator new(size, std::nothrow);
+        }
+
+        /**
+         * Frees an allocated memory.
+         *
+         * @param ptr address of allocated memory block or a null pointer.
+         */
+        static void free(void* ptr)
+        {
+            ::operator delete(ptr);
+        }
+
+    };
+}
+
+#endif // ALLOCATOR_HPP_
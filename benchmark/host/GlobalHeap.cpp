@@ -0,0 +1,652 @@
+/**
+ * Global operators new and delete of a host program on the library heap.
+ *
+ * A host program linked with this translation unit allocates all its memory
+ * of the operators in one library heap, which is created in a static region
+ * of the EOOS_GLOBAL_HEAP_SIZE bytes on the first allocation, and is locked
+ * by a mutex. As the host allocator calls the operators, the library objects
+ * are allocated in the heap too.
+ *
+ * Memory of small sizes is allocated in size classes of sixteen bytes. Blocks
+ * of a class are cut from slabs allocated in the heap, and freed blocks are
+ * cached by each thread, so that frequent allocations and frees of small
+ * objects neither lock nor search the heap. Blocks exceeding a cache and
+ * blocks of exiting threads are moved to central lists of the classes,
+ * and the slabs are never freed to the heap. Memory aligned stricter than
+ * sixteen bytes, which is allocated by the aligned operators of C++17,
+ * is allocated in the heap.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#include "library.Heap.hpp"
+#include <new>
+#include <pthread.h>
+
+#ifndef EOOS_GLOBAL_HEAP_SIZE
+#define EOOS_GLOBAL_HEAP_SIZE 0x2000000
+#endif // EOOS_GLOBAL_HEAP_SIZE
+
+#if __cplusplus >= 201103L
+#define GLOBAL_HEAP_THROW
+#define GLOBAL_HEAP_NOTHROW noexcept
+#else
+#define GLOBAL_HEAP_THROW throw(std::bad_alloc)
+#define GLOBAL_HEAP_NOTHROW throw()
+#endif // C++11
+
+namespace local
+{
+    namespace host
+    {
+        /**
+         * Toggle locking a mutex.
+         */
+        class Mutex : public api::Toggle
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            Mutex()
+            {
+                static_cast<void>( ::pthread_mutex_init(&mutex_, NULL) );
+            }
+
+            /**
+             * Destructor.
+             */
+            virtual ~Mutex()
+            {
+                static_cast<void>( ::pthread_mutex_destroy(&mutex_) );
+            }
+
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */
+            virtual bool isConstructed() const
+            {
+                return true;
+            }
+
+            /**
+             * Locks the mutex.
+             *
+             * @return true.
+             */
+            virtual bool disable()
+            {
+                static_cast<void>( ::pthread_mutex_lock(&mutex_) );
+                return true;
+            }
+
+            /**
+             * Unlocks the mutex.
+             *
+             * @param status - unused.
+             */
+            virtual void enable(bool)
+            {
+                static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            }
+
+        private:
+
+            /**
+             * The mutex.
+             */
+            ::pthread_mutex_t mutex_;
+
+        };
+
+        class GlobalHeap
+        {
+
+        public:
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size)
+            {
+                void* res;
+                // Larger memory never fits the heap, and its size calculations might overflow
+                if(size > MAX_SIZE)
+                {
+                    res = NULL;
+                }
+                else if(size <= CLASSES * GRANULE)
+                {
+                    Cache& cache = getCache();
+                    size_t const index = size != 0 ? (size - 1) / GRANULE : 0;
+                    if(cache.lists[index] == NULL)
+                    {
+                        refill(cache, index + 1);
+                    }
+                    res = cache.lists[index];
+                    if(res != NULL)
+                    {
+                        cache.lists[index] = getNext(res);
+                        cache.lengths[index]--;
+                    }
+                }
+                else
+                {
+                    res = create(size, GRANULE);
+                }
+                return res;
+            }
+
+            /**
+             * Allocates aligned memory.
+             *
+             * @param size      - number of bytes to allocate.
+             * @param alignment - alignment of the memory, which is a power of two.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size, size_t const alignment)
+            {
+                void* res;
+                if( alignment == 0 || ( alignment & (alignment - 1) ) != 0 || alignment > MAX_SIZE )
+                {
+                    res = NULL;
+                }
+                else if(alignment <= GRANULE)
+                {
+                    res = allocate(size);
+                }
+                else if(size > MAX_SIZE)
+                {
+                    res = NULL;
+                }
+                else
+                {
+                    res = create(size, alignment);
+                }
+                return res;
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            static void free(void* const ptr)
+            {
+                if(ptr != NULL)
+                {
+                    size_t const sizeClass = getHeader(ptr)->sizeClass;
+                    if(sizeClass != 0)
+                    {
+                        Cache& cache = getCache();
+                        size_t const index = sizeClass - 1;
+                        getNext(ptr) = cache.lists[index];
+                        cache.lists[index] = ptr;
+                        cache.lengths[index]++;
+                        if(cache.lengths[index] > CACHE_LENGTH)
+                        {
+                            release(cache, index, BATCH);
+                        }
+                    }
+                    else
+                    {
+                        heap_->free( getHeader(ptr)->block );
+                    }
+                }
+            }
+
+        private:
+
+            /**
+             * Size in byte of a size class step.
+             */
+            static const size_t GRANULE = 16;
+
+            /**
+             * Number of size classes.
+             */
+            static const size_t CLASSES = 32;
+
+            /**
+             * Maximum size in byte of a memory, which is the heap region size.
+             */
+            static const size_t MAX_SIZE = EOOS_GLOBAL_HEAP_SIZE;
+
+            /**
+             * Number of blocks moved between a thread cache and the central lists at once.
+             */
+            static const int32 BATCH = 32;
+
+            /**
+             * Maximum number of cached blocks of a size class.
+             */
+            static const int32 CACHE_LENGTH = 64;
+
+            /**
+             * Header of an allocated memory, which precedes the memory.
+             */
+            struct Header
+            {
+                /**
+                 * Block allocated in the heap, or NULL for a block of a size class.
+                 */
+                void* block;
+
+                /**
+                 * Size class of the memory, or zero for a large memory.
+                 */
+                size_t sizeClass;
+
+            };
+
+            /**
+             * Cache of freed blocks of a thread.
+             */
+            struct Cache
+            {
+                /**
+                 * Lists of the blocks of the size classes.
+                 */
+                void* lists[CLASSES];
+
+                /**
+                 * Lengths of the lists.
+                 */
+                int32 lengths[CLASSES];
+
+                /**
+                 * The cache has been registered to be flushed.
+                 */
+                bool isRegistered;
+
+            };
+
+            /**
+             * Returns the cache of the current thread.
+             *
+             * @return the cache.
+             */
+            static Cache& getCache()
+            {
+                Cache& cache = cache_;
+                if( not cache.isRegistered )
+                {
+                    // Register the cache to be flushed when the thread exits
+                    static_cast<void>( ::pthread_once(&once_, initialize) );
+                    cache.isRegistered = ::pthread_setspecific(key_, &cache) == 0 ? true : false;
+                }
+                return cache;
+            }
+
+            /**
+             * Moves blocks of a size class from the central list or from a new slab to a thread cache.
+             *
+             * @param cache     - the thread cache.
+             * @param sizeClass - the size class.
+             */
+            static void refill(Cache& cache, size_t const sizeClass)
+            {
+                size_t const index = sizeClass - 1;
+                static_cast<void>( ::pthread_mutex_lock(&mutex_) );
+                for(int32 i=0; i<BATCH && central_[index] != NULL; i++)
+                {
+                    void* const block = central_[index];
+                    central_[index] = getNext(block);
+                    getNext(block) = cache.lists[index];
+                    cache.lists[index] = block;
+                    cache.lengths[index]++;
+                }
+                static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+                if(cache.lists[index] == NULL && heap_ != NULL)
+                {
+                    // A slab of blocks is never freed to the heap
+                    size_t const stride = GRANULE + sizeClass * GRANULE;
+                    void* const slab = heap_->allocate(stride * BATCH + 8, NULL);
+                    if(slab != NULL)
+                    {
+                        uintptr addr = getAligned(slab, GRANULE);
+                        for(int32 i=0; i<BATCH; i++)
+                        {
+                            void* const block = reinterpret_cast<void*>(addr);
+                            Header* const header = getHeader(block);
+                            header->block = NULL;
+                            header->sizeClass = sizeClass;
+                            getNext(block) = cache.lists[index];
+                            cache.lists[index] = block;
+                            cache.lengths[index]++;
+                            addr += stride;
+                        }
+                    }
+                }
+            }
+
+            /**
+             * Moves blocks of a size class from a thread cache to the central list.
+             *
+             * @param cache - the thread cache.
+             * @param index - an index of the size class.
+             * @param count - a number of the blocks.
+             */
+            static void release(Cache& cache, size_t const index, int32 const count)
+            {
+                static_cast<void>( ::pthread_mutex_lock(&mutex_) );
+                for(int32 i=0; i<count && cache.lists[index] != NULL; i++)
+                {
+                    void* const block = cache.lists[index];
+                    cache.lists[index] = getNext(block);
+                    cache.lengths[index]--;
+                    getNext(block) = central_[index];
+                    central_[index] = block;
+                }
+                static_cast<void>( ::pthread_mutex_unlock(&mutex_) );
+            }
+
+            /**
+             * Allocates a large or strictly aligned memory in the heap.
+             *
+             * @param size      - number of bytes to allocate, which does not exceed the maximum size.
+             * @param alignment - alignment of the memory, which is a power of two not less than sixteen.
+             * @return the memory, or a null pointer.
+             */
+            static void* create(size_t const size, size_t const alignment)
+            {
+                void* res = NULL;
+                static_cast<void>( ::pthread_once(&once_, initialize) );
+                if(heap_ != NULL)
+                {
+                    // A heap block is aligned to eight, so the memory is at most alignment minus eight bytes after a header
+                    void* const block = heap_->allocate(size + GRANULE + alignment - 8, NULL);
+                    if(block != NULL)
+                    {
+                        res = reinterpret_cast<void*>( getAligned(block, alignment) );
+                        Header* const header = getHeader(res);
+                        header->block = block;
+                        header->sizeClass = 0;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Returns the first aligned memory after a header in a heap block.
+             *
+             * @param block     - the heap block, which is aligned to eight.
+             * @param alignment - alignment of the memory, which is a power of two not less than sixteen.
+             * @return the memory address.
+             */
+            static uintptr getAligned(void* const block, size_t const alignment)
+            {
+                return ( reinterpret_cast<uintptr>(block) + GRANULE + alignment - 1 ) & ~(alignment - 1);
+            }
+
+            /**
+             * Returns a header of a memory.
+             *
+             * @param ptr - the memory.
+             * @return the header.
+             */
+            static Header* getHeader(void* const ptr)
+            {
+                return reinterpret_cast<Header*>( reinterpret_cast<uintptr>(ptr) - GRANULE );
+            }
+
+            /**
+             * Returns a link to the next free block, which is kept in a free block.
+             *
+             * @param block - the free block.
+             * @return the link.
+             */
+            static void*& getNext(void* const block)
+            {
+                return *reinterpret_cast<void**>(block);
+            }
+
+            /**
+             * Creates the heap.
+             */
+            static void initialize()
+            {
+                // The objects are never destroyed, as memory might be freed after exiting
+                toggle_ = new (toggleMemory_) Mutex();
+                library::Heap* const heap = new ( reinterpret_cast<intptr>(region_) ) library::Heap(sizeof(region_), toggle_);
+                if(heap != NULL && heap->isConstructed())
+                {
+                    heap_ = heap;
+                }
+                static_cast<void>( ::pthread_key_create(&key_, flush) );
+            }
+
+            /**
+             * Moves blocks cached by an exiting thread to the central lists.
+             *
+             * @param arg - the cache.
+             */
+            static void flush(void* const arg)
+            {
+                Cache* const cache = reinterpret_cast<Cache*>(arg);
+                for(size_t i=0; i<CLASSES; i++)
+                {
+                    release(*cache, i, cache->lengths[i]);
+                }
+                cache->isRegistered = false;
+            }
+
+            /**
+             * Control of creating the heap.
+             */
+            static ::pthread_once_t once_;
+
+            /**
+             * Key of flushing the caches of exiting threads.
+             */
+            static ::pthread_key_t key_;
+
+            /**
+             * Mutex of the central lists.
+             */
+            static ::pthread_mutex_t mutex_;
+
+            /**
+             * Central lists of free blocks of the size classes.
+             */
+            static void* central_[CLASSES];
+
+            /**
+             * The heap, or NULL if it has not been created.
+             */
+            static library::Heap* heap_;
+
+            /**
+             * The toggle of the heap.
+             */
+            static api::Toggle* toggle_;
+
+            /**
+             * Memory of the toggle.
+             */
+            static uint64 toggleMemory_[ (sizeof(Mutex) + 7) / 8 ];
+
+            /**
+             * Memory of the heap.
+             */
+            static uint64 region_[ EOOS_GLOBAL_HEAP_SIZE / 8 ];
+
+            /**
+             * The cache of a thread.
+             */
+            static __thread Cache cache_;
+
+        };
+
+        ::pthread_once_t GlobalHeap::once_ = PTHREAD_ONCE_INIT;
+
+        ::pthread_key_t GlobalHeap::key_;
+
+        ::pthread_mutex_t GlobalHeap::mutex_ = PTHREAD_MUTEX_INITIALIZER;
+
+        void* GlobalHeap::central_[CLASSES];
+
+        library::Heap* GlobalHeap::heap_ = NULL;
+
+        api::Toggle* GlobalHeap::toggle_ = NULL;
+
+        uint64 GlobalHeap::toggleMemory_[ (sizeof(Mutex) + 7) / 8 ];
+
+        uint64 GlobalHeap::region_[ EOOS_GLOBAL_HEAP_SIZE / 8 ];
+
+        __thread GlobalHeap::Cache GlobalHeap::cache_;
+
+        /**
+         * Allocates memory or throws an exception.
+         *
+         * @param size - number of bytes to allocate.
+         * @return allocated memory address.
+         */
+        static void* allocate(size_t const size)
+        {
+            void* const ptr = GlobalHeap::allocate(size);
+            if(ptr == NULL)
+            {
+                throw std::bad_alloc();
+            }
+            return ptr;
+        }
+
+        #ifdef __cpp_aligned_new
+
+        /**
+         * Allocates aligned memory or throws an exception.
+         *
+         * @param size      - number of bytes to allocate.
+         * @param alignment - alignment of the memory.
+         * @return allocated memory address.
+         */
+        static void* allocate(size_t const size, std::align_val_t const alignment)
+        {
+            void* const ptr = GlobalHeap::allocate( size, static_cast<size_t>(alignment) );
+            if(ptr == NULL)
+            {
+                throw std::bad_alloc();
+            }
+            return ptr;
+        }
+
+        #endif // __cpp_aligned_new
+    }
+}
+
+void* operator new(size_t size) GLOBAL_HEAP_THROW
+{
+    return ::local::host::allocate(size);
+}
+
+void* operator new[](size_t size) GLOBAL_HEAP_THROW
+{
+    return ::local::host::allocate(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    return ::local::host::GlobalHeap::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    return ::local::host::GlobalHeap::allocate(size);
+}
+
+void operator delete(void* ptr) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+#ifdef __cpp_sized_deallocation
+
+void operator delete(void* ptr, size_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+#endif // __cpp_sized_deallocation
+
+#ifdef __cpp_aligned_new
+
+void* operator new(size_t size, std::align_val_t alignment) GLOBAL_HEAP_THROW
+{
+    return ::local::host::allocate(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) GLOBAL_HEAP_THROW
+{
+    return ::local::host::allocate(size, alignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    return ::local::host::GlobalHeap::allocate( size, static_cast<size_t>(alignment) );
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    return ::local::host::GlobalHeap::allocate( size, static_cast<size_t>(alignment) );
+}
+
+void operator delete(void* ptr, std::align_val_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) GLOBAL_HEAP_NOTHROW
+{
+    ::local::host::GlobalHeap::free(ptr);
+}
+
+#endif // __cpp_aligned_new
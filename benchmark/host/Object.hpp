@@ -0,0 +1,126 @@
+/**
+ * Root class of the operating system class hierarchy.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef OBJECT_HPP_
+#define OBJECT_HPP_
+
+#include "Types.hpp"
+#include "Allocator.hpp"
+#include "api.Object.hpp"
+
+namespace local
+{
+    template <class A = Allocator>
+    class Object : public virtual api::Object
+    {
+
+    public:
+
+        /**
+         * Constructor.
+         */
+        Object() :
+            isConstructed_ (true){
+        }
+
+        /**
+         * Copy constructor.
+         *
+         * @param obj reference to source object.
+         */
+        Object(const Object& obj) :
+            isConstructed_ (obj.isConstructed_){
+        }
+
+        /**
+         * Destructor.
+         */
+        virtual ~Object()
+        {
+        }
+
+        /**
+         * Assignment operator.
+         *
+         * @param obj reference to source object.
+         * @return reference to this object.
+         */
+        Object& operator=(const Object& obj)
+        {
+            isConstructed_ = obj.isConstructed_;
+            return *this;
+        }
+
+        /**
+         * Tests if this object has been constructed.
+         *
+         * @return true if object has been constructed successfully.
+         */
+        virtual bool isConstructed() const
+        {
+            return isConstructed_;
+        }
+
+        /**
+         * Operator new.
+         *
+         * @param size number of bytes to allocate.
+         * @return allocated memory address or a null pointer.
+         */
+        static void* operator new(size_t size)
+        {
+            return A::allocate(size);
+        }
+
+        /**
+         * Operator delete.
+         *
+         * @param ptr address of allocated memory block or a null pointer.
+         */
+        static void operator delete(void* ptr)
+        {
+            A::free(ptr);
+        }
+
+        /**
+         * Operator new.
+         *
+         * @param size unused.
+         * @param ptr  pointer to reserved memory area.
+         * @return given pointer.
+         */
+        static void* operator new(size_t, void* ptr)
+        {
+            return ptr;
+        }
+
+    protected:
+
+        /**
+         * Sets the object constructed flag.
+         *
+         * @param flag constructed flag, which cannot be set to true after it has been set to false.
+         */
+        void setConstructed(bool flag)
+        {
+            if(isConstructed_ == true)
+            {
+                isConstructed_ = flag;
+            }
+        }
+
+        /**
+         * The root object constructed flag.
+         */
+        bool isConstructed_;
+
+    };
+}
+
+#endif // OBJECT_HPP_
@@ -0,0 +1,33 @@
+/**
+ * Basic data types.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef TYPES_HPP_
+#define TYPES_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace local
+{
+    typedef int8_t     int8;
+    typedef uint8_t    uint8;
+    typedef int16_t    int16;
+    typedef uint16_t   uint16;
+    typedef int32_t    int32;
+    typedef uint32_t   uint32;
+    typedef int64_t    int64;
+    typedef uint64_t   uint64;
+    typedef int8_t     cell;
+    typedef uint8_t    ucell;
+    typedef intptr_t   intptr;
+    typedef uintptr_t  uintptr;
+    using ::size_t;
+}
+
+#endif // TYPES_HPP_
@@ -0,0 +1,49 @@
+/**
+ * Collection interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_COLLECTION_HPP_
+#define API_COLLECTION_HPP_
+
+#include "api.Object.hpp"
+#include "Types.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class Collection : public virtual api::Object
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Collection() {}
+
+            /**
+             * Returns a number of elements.
+             *
+             * @return number of elements.
+             */
+            virtual int32 getLength() const = 0;
+
+            /**
+             * Tests if this collection has elements.
+             *
+             * @return true if this collection does not contain any elements.
+             */
+            virtual bool isEmpty() const = 0;
+
+        };
+    }
+}
+
+#endif // API_COLLECTION_HPP_
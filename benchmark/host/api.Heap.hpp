@@ -0,0 +1,52 @@
+/**
+ * Heap memory interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_HEAP_HPP_
+#define API_HEAP_HPP_
+
+#include "api.Object.hpp"
+#include "Types.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        class Heap : public virtual api::Object
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Heap() {}
+
+            /**
+             * Allocates memory.
+             *
+             * @param size required memory size in byte.
+             * @param ptr  NULL value becomes to allocate memory, and
+             *             other given values are simply returned
+             *             as memory address.
+             * @return pointer to allocated memory or NULL.
+             */
+            virtual void* allocate(size_t size, void* ptr) = 0;
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr pointer to allocated memory.
+             */
+            virtual void free(void* ptr) = 0;
+
+        };
+    }
+}
+
+#endif // API_HEAP_HPP_
@@ -0,0 +1,54 @@
+/**
+ * Illegal value interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_ILLEGAL_VALUE_HPP_
+#define API_ILLEGAL_VALUE_HPP_
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class IllegalValue
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~IllegalValue() {}
+
+            /**
+             * Returns illegal element which will be returned as error value.
+             *
+             * @return illegal element.
+             */
+            virtual T& getIllegal() const = 0;
+
+            /**
+             * Sets illegal element which will be returned as error value.
+             *
+             * @param value illegal value.
+             */
+            virtual void setIllegal(const T& value) = 0;
+
+            /**
+             * Tests if given value is an illegal.
+             *
+             * @param value testing value.
+             * @param true if value is an illegal.
+             */
+            virtual bool isIllegal(const T& value) const = 0;
+
+        };
+    }
+}
+
+#endif // API_ILLEGAL_VALUE_HPP_
@@ -0,0 +1,41 @@
+/**
+ * Iterable interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_ITERABLE_HPP_
+#define API_ITERABLE_HPP_
+
+#include "api.Iterator.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class Iterable
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Iterable() {}
+
+            /**
+             * Returns an iterator of elements.
+             *
+             * @return pointer to new iterator.
+             */
+            virtual api::Iterator<T>* getIterator() = 0;
+
+        };
+    }
+}
+
+#endif // API_ITERABLE_HPP_
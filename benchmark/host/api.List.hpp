@@ -0,0 +1,134 @@
+/**
+ * List interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_LIST_HPP_
+#define API_LIST_HPP_
+
+#include "api.Collection.hpp"
+#include "api.IllegalValue.hpp"
+#include "api.ListIterator.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class List : public api::Collection<T>, public api::IllegalValue<T>
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~List() {}
+
+            /**
+             * Inserts new element to the end of this list.
+             *
+             * @param element inserting element.
+             * @return true if element is added.
+             */
+            virtual bool add(const T& element) = 0;
+
+            /**
+             * Inserts new element to the specified position in this list.
+             *
+             * @param index   position in this list.
+             * @param element inserting element.
+             * @return true if element is inserted.
+             */
+            virtual bool add(int32 index, const T& element) = 0;
+
+            /**
+             * Removes all elements from this list.
+             */
+            virtual void clear() = 0;
+
+            /**
+             * Removes the first element from this list.
+             *
+             * @return true if an element is removed successfully.
+             */
+            virtual bool removeFirst() = 0;
+
+            /**
+             * Removes the last element from this list.
+             *
+             * @return true if an element is removed successfully.
+             */
+            virtual bool removeLast() = 0;
+
+            /**
+             * Removes the element at the specified position in this list.
+             *
+             * @param index position in this list.
+             * @return true if an element is removed successfully.
+             */
+            virtual bool remove(int32 index) = 0;
+
+            /**
+             * Removes the first occurrence of the specified element from this list.
+             *
+             * @param element reference to element.
+             * @return true if an element is removed successfully.
+             */
+            virtual bool removeElement(const T& element) = 0;
+
+            /**
+             * Returns the first element in this list.
+             *
+             * @return the first element in this list.
+             */
+            virtual T& getFirst() const = 0;
+
+            /**
+             * Returns the last element in this list.
+             *
+             * @return the last element in this list.
+             */
+            virtual T& getLast() const = 0;
+
+            /**
+             * Returns an element of this list by index.
+             *
+             * @param index position in this list.
+             * @return indexed element of this list.
+             */
+            virtual T& get(int32 index) const = 0;
+
+            /**
+             * Returns a list iterator of this list elements.
+             *
+             * @param index start position in this list.
+             * @return pointer to new list iterator.
+             */
+            virtual api::ListIterator<T>* getListIterator(int32 index) = 0;
+
+            /**
+             * Returns the index of the first occurrence of the specified element in this list.
+             *
+             * @param element reference to the element.
+             * @return index or -1 if this list does not contain the element.
+             */
+            virtual int32 getIndexOf(const T& element) const = 0;
+
+            /**
+             * Tests if given index is available.
+             *
+             * @param index checking position in this list.
+             * @return true if index is present.
+             */
+            virtual bool isIndex(int32 index) const = 0;
+
+        };
+    }
+}
+
+#endif // API_LIST_HPP_
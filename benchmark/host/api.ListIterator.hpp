@@ -0,0 +1,71 @@
+/**
+ * List iterator interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_LIST_ITERATOR_HPP_
+#define API_LIST_ITERATOR_HPP_
+
+#include "api.Iterator.hpp"
+#include "Types.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class ListIterator : public api::Iterator<T>
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~ListIterator() {}
+
+            /**
+             * Inserts the specified element into the list.
+             *
+             * @param element inserting element.
+             * @return true if an element is inserted successfully.
+             */
+            virtual bool add(const T& element) = 0;
+
+            /**
+             * Returns previous element and advances the cursor backwards.
+             *
+             * @return reference to element.
+             */
+            virtual T& getPrevious() const = 0;
+
+            /**
+             * Returns the index of the element that would be returned by a subsequent call to getPrevious().
+             *
+             * @return index of the previous element or -1 if the list iterator is at the beginning of the list.
+             */
+            virtual int32 getPreviousIndex() const = 0;
+
+            /**
+             * Tests if this iteration may return a previous element.
+             *
+             * @return true if previous element is had.
+             */
+            virtual bool hasPrevious() const = 0;
+
+            /**
+             * Returns the index of the element that would be returned by a subsequent call to getNext().
+             *
+             * @return index of the next element or list size if the list iterator is at the end of the list.
+             */
+            virtual int32 getNextIndex() const = 0;
+
+        };
+    }
+}
+
+#endif // API_LIST_ITERATOR_HPP_
@@ -0,0 +1,38 @@
+/**
+ * Root interface of the operating system class hierarchy.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_OBJECT_HPP_
+#define API_OBJECT_HPP_
+
+namespace local
+{
+    namespace api
+    {
+        class Object
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Object() {}
+
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */
+            virtual bool isConstructed() const = 0;
+
+        };
+    }
+}
+
+#endif // API_OBJECT_HPP_
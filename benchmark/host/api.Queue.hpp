@@ -0,0 +1,57 @@
+/**
+ * Queue interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_QUEUE_HPP_
+#define API_QUEUE_HPP_
+
+#include "api.Collection.hpp"
+#include "api.IllegalValue.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class Queue : public api::Collection<T>, public api::IllegalValue<T>
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Queue() {}
+
+            /**
+             * Inserts new element to this container.
+             *
+             * @param element inserting element.
+             * @return true if element is added.
+             */
+            virtual bool add(const T& element) = 0;
+
+            /**
+             * Removes the head element of this container.
+             *
+             * @return true if an element is removed successfully.
+             */
+            virtual bool remove() = 0;
+
+            /**
+             * Examines the head element of this container.
+             *
+             * @return the head element.
+             */
+            virtual T& peek() const = 0;
+
+        };
+    }
+}
+
+#endif // API_QUEUE_HPP_
@@ -0,0 +1,65 @@
+/**
+ * String interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_STRING_HPP_
+#define API_STRING_HPP_
+
+#include "api.Collection.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        template <typename T>
+        class String : public api::Collection<T>
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~String() {}
+
+            /**
+             * Returns pointer to the first character of containing string.
+             *
+             * @return first character of containing string characters, or NULL if no string contained.
+             */
+            virtual const T* getChar() const = 0;
+
+            /**
+             * Copies a passed string into this string.
+             *
+             * @param string a string object to be copied.
+             * @return true if a passed string has been copied successfully.
+             */
+            virtual bool copy(const api::String<T>& string) = 0;
+
+            /**
+             * Concatenates a passed string to this string.
+             *
+             * @param string a string object to be appended.
+             * @return true if a passed string has been appended successfully.
+             */
+            virtual bool concatenate(const api::String<T>& string) = 0;
+
+            /**
+             * Compares this string with a passed string lexicographically.
+             *
+             * @param string a string object to be compared.
+             * @return the value 0 if a passed string is equal to this string.
+             */
+            virtual int32 compare(const api::String<T>& string) const = 0;
+
+        };
+    }
+}
+
+#endif // API_STRING_HPP_
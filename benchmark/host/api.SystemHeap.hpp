@@ -0,0 +1,46 @@
+/**
+ * System heap memory interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_SYSTEM_HEAP_HPP_
+#define API_SYSTEM_HEAP_HPP_
+
+#include "api.Heap.hpp"
+#include "api.Toggle.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        class SystemHeap : public api::Heap
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~SystemHeap() {}
+
+            /**
+             * Sets a context switching locker.
+             *
+             * @param toggle reference to pointer to some controller.
+             */
+            virtual void setToggle(api::Toggle*& toggle) = 0;
+
+            /**
+             * Resets a context switching locker.
+             */
+            virtual void resetToggle() = 0;
+
+        };
+    }
+}
+
+#endif // API_SYSTEM_HEAP_HPP_
@@ -0,0 +1,47 @@
+/**
+ * Toggle interface.
+ *
+ * The header is a stand-in of the system header for building the library on a host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef API_TOGGLE_HPP_
+#define API_TOGGLE_HPP_
+
+#include "api.Object.hpp"
+
+namespace local
+{
+    namespace api
+    {
+        class Toggle : public virtual api::Object
+        {
+
+        public:
+
+            /**
+             * Destructor.
+             */
+            virtual ~Toggle() {}
+
+            /**
+             * Disables a controller.
+             *
+             * @return an enable source bit value of a controller before method was called.
+             */
+            virtual bool disable() = 0;
+
+            /**
+             * Enables a controller.
+             *
+             * @param status returned status by disable method.
+             */
+            virtual void enable(bool status) = 0;
+
+        };
+    }
+}
+
+#endif // API_TOGGLE_HPP_
@@ -0,0 +1,311 @@
+/**
+ * Benchmarks of the library containers and strings.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#include "Benchmark.hpp"
+#include "library.LinkedList.hpp"
+#include "library.CircularList.hpp"
+#include "library.Buffer.hpp"
+#include "library.String.hpp"
+
+namespace local
+{
+    namespace benchmark
+    {
+        typedef Benchmark::Stopwatch Stopwatch;
+
+        /**
+         * Number of repeated operations on a data set.
+         */
+        static const int32 REPEATS = 64;
+
+        /**
+         * Adding elements to the end of a list.
+         */
+        template <class L>
+        struct ListAdd
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                L list;
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    list.add(i);
+                }
+                watch.stop();
+                return size;
+            }
+        };
+
+        /**
+         * Removing the first elements of a list.
+         */
+        template <class L>
+        struct ListRemove
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                L list;
+                for(int32 i=0; i<size; i++)
+                {
+                    list.add(i);
+                }
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    list.removeFirst();
+                }
+                watch.stop();
+                return size;
+            }
+        };
+
+        /**
+         * Getting elements of a list by indexes.
+         */
+        template <class L>
+        struct ListGet
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                L list;
+                for(int32 i=0; i<size; i++)
+                {
+                    list.add(i);
+                }
+                int64 sum = 0;
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    sum += list.get(i);
+                }
+                watch.stop();
+                Benchmark::keep(sum);
+                return size;
+            }
+        };
+
+        /**
+         * Iterating elements of a list.
+         */
+        template <class L>
+        struct ListIterate
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                L list;
+                for(int32 i=0; i<size; i++)
+                {
+                    list.add(i);
+                }
+                int64 sum = 0;
+                watch.start();
+                api::ListIterator<int32>* const it = list.getListIterator(0);
+                // A circular list iterator never ends, so a number of elements is iterated
+                for(int32 i=0; i<size; i++)
+                {
+                    sum += it->getNext();
+                }
+                delete it;
+                watch.stop();
+                Benchmark::keep(sum);
+                return size;
+            }
+        };
+
+        /**
+         * Copying strings.
+         */
+        struct StringCopy
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::Buffer<char,0> chars(size + 1);
+                chars.fill('a');
+                chars[size] = '\0';
+                const char* const source = &chars[0];
+                library::String<char,0> string;
+                watch.start();
+                for(int32 i=0; i<REPEATS; i++)
+                {
+                    string = source;
+                }
+                watch.stop();
+                Benchmark::keep( string.getLength() );
+                return REPEATS;
+            }
+        };
+
+        /**
+         * Concatenating eight characters to a string.
+         */
+        struct StringConcatenate
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                const int32 count = size / 8;
+                library::String<char,0> string;
+                watch.start();
+                for(int32 i=0; i<count; i++)
+                {
+                    string += "abcdefgh";
+                }
+                watch.stop();
+                Benchmark::keep( string.getLength() );
+                return count;
+            }
+        };
+
+        /**
+         * Comparing equal strings.
+         */
+        struct StringCompare
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::Buffer<char,0> chars(size + 1);
+                chars.fill('a');
+                chars[size] = '\0';
+                const library::String<char,0> string1( &chars[0] );
+                const library::String<char,0> string2( &chars[0] );
+                int64 sum = 0;
+                watch.start();
+                for(int32 i=0; i<REPEATS; i++)
+                {
+                    sum += string1.compare(string2);
+                }
+                watch.stop();
+                Benchmark::keep(sum);
+                return REPEATS;
+            }
+        };
+
+        /**
+         * Converting integer numbers to strings.
+         */
+        struct StringConvert
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::String<char,0> string;
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    string.convert<int32>(i * 7919);
+                }
+                watch.stop();
+                Benchmark::keep( string.getLength() );
+                return size;
+            }
+        };
+
+        /**
+         * Filling buffer elements.
+         */
+        struct BufferFill
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::Buffer<int32,0> buffer(size);
+                watch.start();
+                for(int32 i=0; i<REPEATS; i++)
+                {
+                    buffer.fill(i);
+                }
+                watch.stop();
+                Benchmark::keep( buffer[size - 1] );
+                return static_cast<int64>(REPEATS) * size;
+            }
+        };
+
+        /**
+         * Copying buffer elements.
+         */
+        struct BufferCopy
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::Buffer<int32,0> source(size);
+                library::Buffer<int32,0> buffer(size);
+                source.fill(1);
+                watch.start();
+                for(int32 i=0; i<REPEATS; i++)
+                {
+                    buffer = source;
+                }
+                watch.stop();
+                Benchmark::keep( buffer[size - 1] );
+                return static_cast<int64>(REPEATS) * size;
+            }
+        };
+
+        /**
+         * Reading buffer elements by indexes.
+         */
+        struct BufferIndex
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                library::Buffer<int32,0> buffer(size);
+                buffer.fill(1);
+                int64 sum = 0;
+                watch.start();
+                for(int32 i=0; i<size; i++)
+                {
+                    sum += buffer[i];
+                }
+                watch.stop();
+                Benchmark::keep(sum);
+                return size;
+            }
+        };
+
+        /**
+         * Sizes of data sets.
+         */
+        static const int32 SIZES[] = {16, 256, 4096};
+
+        /**
+         * Runs all benchmarks.
+         */
+        static void run()
+        {
+            typedef library::LinkedList<int32> LinkedList;
+            typedef library::CircularList<int32> CircularList;
+            for(uint32 i=0; i<sizeof(SIZES) / sizeof(SIZES[0]); i++)
+            {
+                const int32 size = SIZES[i];
+                Benchmark::run("LinkedList.add", size, ListAdd<LinkedList>());
+                Benchmark::run("LinkedList.removeFirst", size, ListRemove<LinkedList>());
+                Benchmark::run("LinkedList.get", size, ListGet<LinkedList>());
+                Benchmark::run("LinkedList.iterate", size, ListIterate<LinkedList>());
+                Benchmark::run("CircularList.add", size, ListAdd<CircularList>());
+                Benchmark::run("CircularList.removeFirst", size, ListRemove<CircularList>());
+                Benchmark::run("CircularList.get", size, ListGet<CircularList>());
+                Benchmark::run("CircularList.iterate", size, ListIterate<CircularList>());
+                Benchmark::run("String.copy", size, StringCopy());
+                Benchmark::run("String.concatenate", size, StringConcatenate());
+                Benchmark::run("String.compare", size, StringCompare());
+                Benchmark::run("String.convert", size, StringConvert());
+                Benchmark::run("Buffer.fill", size, BufferFill());
+                Benchmark::run("Buffer.copy", size, BufferCopy());
+                Benchmark::run("Buffer.index", size, BufferIndex());
+            }
+        }
+    }
+}
+
+/**
+ * The main function.
+ *
+ * @return error code or zero.
+ */
+int main()
+{
+    ::local::benchmark::run();
+    return 0;
+}
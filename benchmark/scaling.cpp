@@ -0,0 +1,169 @@
+/**
+ * Benchmarks of executing tasks by threads.
+ *
+ * A task tree is executed by an executor with work-stealing deques and by
+ * an executor with one shared queue, and the size of a data set is a number
+ * of the worker threads. A task spawns two tasks until a depth of the tree,
+ * and the leaf tasks perform some calculations.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#include "Benchmark.hpp"
+#include "Executor.hpp"
+
+namespace local
+{
+    namespace benchmark
+    {
+        typedef Benchmark::Stopwatch Stopwatch;
+
+        /**
+         * Depth of the task tree.
+         */
+        static const int32 DEPTH = 14;
+
+        /**
+         * Number of calculations of a leaf task.
+         */
+        static const int32 CALCULATIONS = 2000;
+
+        /**
+         * Task of the tree.
+         */
+        class TreeTask : public Executor::Task
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            TreeTask() :
+                tasks_ (NULL),
+                index_ (0),
+                depth_ (0),
+                sum_   (NULL){
+            }
+
+            /**
+             * Sets the task to a node of the tree.
+             *
+             * @param tasks - tasks of all the nodes.
+             * @param index - an index of the node.
+             * @param depth - a depth of the node.
+             * @param sum   - a sum of the leaf calculations.
+             */
+            void set(TreeTask* const tasks, int32 const index, int32 const depth, library::Atomic<uint64>* const sum)
+            {
+                tasks_ = tasks;
+                index_ = index;
+                depth_ = depth;
+                sum_ = sum;
+            }
+
+            /**
+             * Executes this task.
+             *
+             * @param executor - the executor.
+             * @param worker   - an index of the worker executing the task.
+             */
+            virtual void execute(Executor& executor, int32 const worker)
+            {
+                if(depth_ < DEPTH)
+                {
+                    for(int32 i=1; i<=2; i++)
+                    {
+                        TreeTask& child = tasks_[index_ * 2 + i];
+                        child.set(tasks_, index_ * 2 + i, depth_ + 1, sum_);
+                        executor.spawn(worker, &child);
+                    }
+                }
+                else
+                {
+                    uint64 value = static_cast<uint64>(index_);
+                    for(int32 i=0; i<CALCULATIONS; i++)
+                    {
+                        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+                    }
+                    static_cast<void>( sum_->fetchAdd(value >> 32, library::AtomicBase::RELAXED) );
+                }
+            }
+
+        private:
+
+            /**
+             * Tasks of all the nodes.
+             */
+            TreeTask* tasks_;
+
+            /**
+             * Index of the node.
+             */
+            int32 index_;
+
+            /**
+             * Depth of the node.
+             */
+            int32 depth_;
+
+            /**
+             * Sum of the leaf calculations.
+             */
+            library::Atomic<uint64>* sum_;
+
+        };
+
+        /**
+         * Executing the task tree.
+         */
+        template <bool S>
+        struct TreeExecute
+        {
+            int64 operator()(const int32 size, Stopwatch& watch)
+            {
+                const int32 count = (2 << DEPTH) - 1;
+                TreeTask* const tasks = new TreeTask[count];
+                library::Atomic<uint64> sum;
+                tasks[0].set(tasks, 0, 0, &sum);
+                Executor executor(size, S);
+                watch.start();
+                executor.run(&tasks[0]);
+                watch.stop();
+                Benchmark::keep( sum.load() );
+                delete [] tasks;
+                return count;
+            }
+        };
+
+        /**
+         * Numbers of threads.
+         */
+        static const int32 SIZES[] = {1, 2, 4, 8};
+
+        /**
+         * Runs all benchmarks.
+         */
+        static void run()
+        {
+            for(uint32 i=0; i<sizeof(SIZES) / sizeof(SIZES[0]); i++)
+            {
+                const int32 size = SIZES[i];
+                Benchmark::run("Executor.stealing", size, TreeExecute<false>());
+                Benchmark::run("Executor.shared", size, TreeExecute<true>());
+            }
+        }
+    }
+}
+
+/**
+ * The main function.
+ *
+ * @return error code or zero.
+ */
+int main()
+{
+    ::local::benchmark::run();
+    return 0;
+}
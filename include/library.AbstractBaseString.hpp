@@ -9,6 +9,10 @@
 #define LIBRARY_ABSTRACT_BASE_STRING_HPP_
 
 #include "library.Object.hpp"
+#include "library.Construction.hpp"
+#include "library.Counters.hpp"
+#include "library.Memory.hpp"
+#include "library.StringTokenizer.hpp"
 #include "api.String.hpp"
 
 namespace local
@@ -67,6 +71,20 @@ namespace local
                 return Parent::isConstructed();
             }
 
+            #ifdef EOOS_COUNTERS
+
+            /**
+             * Returns counters of this string operations.
+             *
+             * @return the counters.
+             */
+            const Counters& getCounters() const
+            {
+                return counters_;
+            }
+
+            #endif // EOOS_COUNTERS
+
             /**
              * Tests if this collection has elements.
              *
@@ -96,7 +114,7 @@ namespace local
             virtual bool copy(const api::String<T>& string)
             {
                 bool res;
-                if( not Self::isConstructed() || not string.isConstructed() )
+                if( not Construction::isConstructed(*this) || not string.isConstructed() )
                 {
                     res = false;
                 }
@@ -117,7 +135,7 @@ namespace local
             virtual bool concatenate(const api::String<T>& string)
             {
                 bool res;
-                if( not Self::isConstructed() || not string.isConstructed() )
+                if( not Construction::isConstructed(*this) || not string.isConstructed() )
                 {
                     res = false;
                 }
@@ -141,7 +159,7 @@ namespace local
             virtual int32 compare(const api::String<T>& string) const
             {
                 int32 res;
-                if( not Self::isConstructed() || not string.isConstructed() )
+                if( not Construction::isConstructed(*this) || not string.isConstructed() )
                 {
                     res = MINIMUM_POSSIBLE_VALUE_OF_INT32;
                 }
@@ -153,6 +171,236 @@ namespace local
                 return res;
             }
 
+            /**
+             * Replaces all occurrences of a passed string in this string.
+             *
+             * @param target      - a string object to be replaced.
+             * @param replacement - a string object to replace with.
+             * @return true if the occurrences have been replaced successfully.
+             */
+            virtual bool replace(const api::String<T>& target, const api::String<T>& replacement)
+            {
+                bool res;
+                if( not Construction::isConstructed(*this) || not target.isConstructed() || not replacement.isConstructed() )
+                {
+                    res = false;
+                }
+                else
+                {
+                    res = replace(target.getChar(), replacement.getChar());
+                }
+                return res;
+            }
+
+            /**
+             * Replaces all occurrences of a passed string in this string.
+             *
+             * The occurrences are searched from the beginning of this string, and
+             * the resulting string length is calculated before any replacement,
+             * so that the string characters are written in a single pass.
+             *
+             * @param target      - a character string to be replaced.
+             * @param replacement - a character string to replace with.
+             * @return true if the occurrences have been replaced successfully.
+             */
+            virtual bool replace(const T* target, const T* replacement) = 0;
+
+            /**
+             * Returns the index of the first occurrence of a passed string in this string.
+             *
+             * @param string - a string object to be located.
+             * @param index  - an index to start the search from.
+             * @return the index of the string, or -1 if this string does not contain the passed string.
+             */
+            int32 getIndexOf(const api::String<T>& string, int32 const index = 0) const
+            {
+                int32 res;
+                if( not string.isConstructed() )
+                {
+                    res = -1;
+                }
+                else
+                {
+                    res = getIndexOf(string.getChar(), index);
+                }
+                return res;
+            }
+
+            /**
+             * Returns the index of the first occurrence of a passed string in this string.
+             *
+             * @param str   - a character string to be located.
+             * @param index - an index to start the search from.
+             * @return the index of the string, or -1 if this string does not contain the passed string.
+             */
+            int32 getIndexOf(const T* const str, int32 const index = 0) const
+            {
+                int32 res;
+                const T* const string = getChar();
+                int32 const length = getLength();
+                if( not Construction::isConstructed(*this) || string == NULL || str == NULL || index < 0 || index > length )
+                {
+                    res = -1;
+                }
+                else
+                {
+                    res = Memory::getIndexOf(&string[index], length - index, str, getLength(str));
+                    if(res >= 0)
+                    {
+                        res += index;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Returns the index of the first occurrence of a passed character in this string.
+             *
+             * @param ch    - a character to be located.
+             * @param index - an index to start the search from.
+             * @return the index of the character, or -1 if this string does not contain the character.
+             */
+            int32 getIndexOf(const T& ch, int32 const index = 0) const
+            {
+                int32 res;
+                const T* const string = getChar();
+                int32 const length = getLength();
+                if( not Construction::isConstructed(*this) || string == NULL || index < 0 || index > length )
+                {
+                    res = -1;
+                }
+                else
+                {
+                    res = Memory::getIndexOf(&string[index], length - index, ch);
+                    if(res >= 0)
+                    {
+                        res += index;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Tests if this string contains a passed string.
+             *
+             * @param string - a string object to be located.
+             * @return true if this string contains the passed string.
+             */
+            bool contains(const api::String<T>& string) const
+            {
+                return getIndexOf(string) >= 0 ? true : false;
+            }
+
+            /**
+             * Tests if this string contains a passed string.
+             *
+             * @param str - a character string to be located.
+             * @return true if this string contains the passed string.
+             */
+            bool contains(const T* const str) const
+            {
+                return getIndexOf(str) >= 0 ? true : false;
+            }
+
+            /**
+             * Tests if this string starts with a passed string.
+             *
+             * @param string - a string object to be tested.
+             * @return true if this string starts with the passed string.
+             */
+            bool startsWith(const api::String<T>& string) const
+            {
+                return string.isConstructed() ? startsWith( string.getChar() ) : false;
+            }
+
+            /**
+             * Tests if this string starts with a passed string.
+             *
+             * @param str - a character string to be tested.
+             * @return true if this string starts with the passed string.
+             */
+            bool startsWith(const T* const str) const
+            {
+                bool res;
+                const T* const string = getChar();
+                if( not Construction::isConstructed(*this) || string == NULL || str == NULL )
+                {
+                    res = false;
+                }
+                else
+                {
+                    int32 const len = getLength(str);
+                    res = isPrefix(string, getLength(), str, len);
+                }
+                return res;
+            }
+
+            /**
+             * Tests if this string ends with a passed string.
+             *
+             * @param string - a string object to be tested.
+             * @return true if this string ends with the passed string.
+             */
+            bool endsWith(const api::String<T>& string) const
+            {
+                return string.isConstructed() ? endsWith( string.getChar() ) : false;
+            }
+
+            /**
+             * Tests if this string ends with a passed string.
+             *
+             * @param str - a character string to be tested.
+             * @return true if this string ends with the passed string.
+             */
+            bool endsWith(const T* const str) const
+            {
+                bool res;
+                const T* const string = getChar();
+                if( not Construction::isConstructed(*this) || string == NULL || str == NULL )
+                {
+                    res = false;
+                }
+                else
+                {
+                    int32 const length = getLength();
+                    int32 const len = getLength(str);
+                    res = len <= length ? isPrefix(&string[length - len], len, str, len) : false;
+                }
+                return res;
+            }
+
+            /**
+             * Returns a tokenizer of this string.
+             *
+             * NOTE: The tokenizer refers to characters of this string and of a passed delimiter.
+             * By this reason, the tokenizer will be actual until you do not call
+             * no constant method of this class for an object.
+             *
+             * @param string - a string object separating tokens.
+             * @return the tokenizer returning views of tokens.
+             */
+            library::StringTokenizer<T> split(const api::String<T>& string) const
+            {
+                return split( string.isConstructed() ? string.getChar() : NULL );
+            }
+
+            /**
+             * Returns a tokenizer of this string.
+             *
+             * NOTE: The tokenizer refers to characters of this string and of a passed delimiter.
+             * By this reason, the tokenizer will be actual until you do not call
+             * no constant method of this class for an object.
+             *
+             * @param str - a character string separating tokens.
+             * @return the tokenizer returning views of tokens.
+             */
+            library::StringTokenizer<T> split(const T* const str) const
+            {
+                const T* const string = Construction::isConstructed(*this) ? getChar() : NULL;
+                int32 const len = str != NULL ? getLength(str) : 0;
+                return library::StringTokenizer<T>(string, getLength(), str, len);
+            }
+
         protected:
 
             /**
@@ -204,6 +452,7 @@ namespace local
                     str++;
                     len++;
                 }
+                LIBRARY_COUNT(counters_, CHARACTERS_SCANNED, len);
                 return len;
             }
 
@@ -255,11 +504,122 @@ namespace local
                 }
             }
 
+            /**
+             * Returns a number of occurrences of a string in a character array.
+             *
+             * @param str  - a character array to be scanned.
+             * @param len  - a number of characters of the array.
+             * @param sub  - a character string to be located.
+             * @param slen - a number of characters of the string.
+             * @return a number of not overlapped occurrences.
+             */
+            static int32 getCount(const T* const str, int32 const len, const T* const sub, int32 const slen)
+            {
+                int32 count = 0;
+                int32 i = 0;
+                while( slen > 0 && i <= len - slen )
+                {
+                    int32 const index = Memory::getIndexOf(&str[i], len - i, sub, slen);
+                    if(index < 0)
+                    {
+                        break;
+                    }
+                    i += index + slen;
+                    count++;
+                }
+                return count;
+            }
+
+            /**
+             * Replaces all occurrences of a string in a character array.
+             *
+             * The characters are written forward, so that the destination array might be
+             * the source array or might be located before the source one in the same memory.
+             * The resulting string is terminated.
+             *
+             * @param dst  - a destination array where the result would be written.
+             * @param src  - a source character array.
+             * @param len  - a number of characters of the source array.
+             * @param sub  - a character string to be replaced.
+             * @param slen - a number of characters of the replaced string.
+             * @param rep  - a character string to replace with.
+             * @param rlen - a number of characters of the replacing string.
+             */
+            void replace(T* dst, const T* src, int32 len, const T* const sub, int32 const slen, const T* const rep, int32 const rlen) const
+            {
+                while( slen > 0 )
+                {
+                    int32 const index = Memory::getIndexOf(src, len, sub, slen);
+                    if(index < 0)
+                    {
+                        break;
+                    }
+                    for(int32 i=0; i<index; i++)
+                    {
+                        *dst++ = *src++;
+                    }
+                    for(int32 i=0; i<rlen; i++)
+                    {
+                        *dst++ = rep[i];
+                    }
+                    src += slen;
+                    len -= index + slen;
+                }
+                while( len-- > 0 )
+                {
+                    *dst++ = *src++;
+                }
+                *dst = getTerminator();
+            }
+
+            /**
+             * Tests if a character array begins with a prefix.
+             *
+             * @param str  - a character array to be tested.
+             * @param len  - a number of characters of the array.
+             * @param pfx  - a prefix character array.
+             * @param plen - a number of characters of the prefix.
+             * @return true if the array begins with the prefix.
+             */
+            static bool isPrefix(const T* const str, int32 const len, const T* const pfx, int32 const plen)
+            {
+                bool res = plen <= len ? true : false;
+                for(int32 i=0; res && i<plen; i++)
+                {
+                    res = str[i] == pfx[i] ? true : false;
+                }
+                return res;
+            }
+
+            /**
+             * Moves characters to higher addresses of the same array.
+             *
+             * @param dst - a destination address which is not lower than the source one.
+             * @param src - a source character array.
+             * @param len - a number of characters to be moved.
+             */
+            static void move(T* const dst, const T* const src, int32 len)
+            {
+                while( len-- > 0 )
+                {
+                    dst[len] = src[len];
+                }
+            }
+
             /**
              * The minimum possible value of int32 type.
              */
             static const int32 MINIMUM_POSSIBLE_VALUE_OF_INT32 = 0 - 0x7fffffff - 1;
 
+            #ifdef EOOS_COUNTERS
+
+            /**
+             * Counters of this string operations.
+             */
+            mutable Counters counters_;
+
+            #endif // EOOS_COUNTERS
+
         private:
 
             /**
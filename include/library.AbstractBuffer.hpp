@@ -9,6 +9,7 @@
 #define LIBRARY_ABSTRACT_BUFFER_HPP_
 
 #include "library.Object.hpp"
+#include "library.Construction.hpp"
 #include "api.Collection.hpp"
 #include "api.IllegalValue.hpp"
 
@@ -154,7 +155,7 @@ namespace local
             void fill(const T& value, const int32 index, const int32 count)
             {
                 const bool hasIndex = index < length_;
-                if( Self::isConstructed() && hasIndex )
+                if( Construction::isConstructed(*this) && hasIndex )
                 {
                     T* const buf = getBuffer();
                     const int32 length = index + count;
@@ -176,7 +177,7 @@ namespace local
             {
                 T* value;
                 T* const buf = getBuffer();
-                if( not Self::isConstructed() || (index >= length_) || (buf == NULL) )
+                if( not Construction::isConstructed(*this) || (index >= length_) || (buf == NULL) )
                 {
                     value = &illegal_;
                 }
@@ -206,7 +207,7 @@ namespace local
              */
             void copy(const AbstractBuffer& buf)
             {
-                if( Self::isConstructed() )
+                if( Construction::isConstructed(*this) )
                 {
                     const int32 size1 = getLength();
                     const int32 size2 = buf.getLength();
@@ -220,6 +221,22 @@ namespace local
                 }
             }
 
+            #if defined(EOOS_NO_STRICT_MISRA_RULES) && __cplusplus >= 201103L
+
+            /**
+             * Moves a length and an illegal value of a passed buffer to this buffer.
+             *
+             * @param obj - a source object which has no elements after the call.
+             */
+            void move(AbstractBuffer& obj)
+            {
+                length_ = obj.length_;
+                illegal_ = obj.illegal_;
+                obj.length_ = 0;
+            }
+
+            #endif // EOOS_NO_STRICT_MISRA_RULES && C++11
+
         private:
 
             /**
@@ -9,6 +9,11 @@
 #define LIBRARY_ABSTRACT_LINKED_LIST_HPP_
 
 #include "library.Object.hpp"
+#include "library.Construction.hpp"
+#include "library.Allocation.hpp"
+#include "library.Profile.hpp"
+#include "library.Trace.hpp"
+#include "library.Counters.hpp"
 #include "library.Buffer.hpp"
 #include "library.LinkedNode.hpp"
 #include "api.List.hpp"
@@ -30,7 +35,8 @@ namespace local
             public library::Object<A>,
             public api::List<T>,
             public api::Queue<T>,
-            public api::Iterable<T>{
+            public api::Iterable<T>,
+            private library::Allocation<A>{
 
             typedef library::AbstractLinkedList<T,A> Self;
             typedef library::Object<A>               Parent;
@@ -62,6 +68,33 @@ namespace local
                 count_   (0){
             }
 
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this list nodes.
+             */
+            explicit AbstractLinkedList(const library::Allocation<A>& allocation) : Parent(), library::Allocation<A>(allocation),
+                illegal_ (),
+                last_    (NULL),
+                count_   (0){
+            }
+
+            /**
+             * Constructor.
+             *
+             * NOTE: A passed element must be copied to an internal data structure of
+             * this class by calling a copy constructor so that the element
+             * might be invalidated after the function called.
+             *
+             * @param illegal    - an illegal element.
+             * @param allocation - an allocation of this list nodes.
+             */
+            AbstractLinkedList(const T& illegal, const library::Allocation<A>& allocation) : Parent(), library::Allocation<A>(allocation),
+                illegal_ (illegal),
+                last_    (NULL),
+                count_   (0){
+            }
+
             /**
              * Destructor.
              */
@@ -88,7 +121,7 @@ namespace local
              */
             virtual bool add(const T& element)
             {
-                return Self::isConstructed() ? addNode(getLength(), element) : false;
+                return Construction::isConstructed(*this) ? addNode(getLength(), element) : false;
             }
 
             /**
@@ -100,7 +133,7 @@ namespace local
              */
             virtual bool add(int32 const index, const T& element)
             {
-                return Self::isConstructed() ? addNode(index, element) : false;
+                return Construction::isConstructed(*this) ? addNode(index, element) : false;
             }
 
             /**
@@ -108,7 +141,7 @@ namespace local
              */
             virtual void clear()
             {
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return;
                 }
@@ -160,7 +193,7 @@ namespace local
              */
             virtual bool remove(const int32 index)
             {
-                return Self::isConstructed() ? removeNode( getNodeByIndex(index) ) : false;
+                return Construction::isConstructed(*this) ? removeNode( getNodeByIndex(index) ) : false;
             }
 
             /**
@@ -171,7 +204,7 @@ namespace local
              */
             virtual bool removeElement(const T& element)
             {
-                return Self::isConstructed() ? removeNode( getNodeByElement(element) ) : false;
+                return Construction::isConstructed(*this) ? removeNode( getNodeByElement(element) ) : false;
             }
 
             /**
@@ -212,7 +245,7 @@ namespace local
              */
             virtual T& get(int32 index) const
             {
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return illegal_;
                 }
@@ -227,7 +260,7 @@ namespace local
              */
             virtual int32 getLength() const
             {
-                return last_ == NULL ? 0 : last_->getIndex() + 1;
+                return getNodesNumber();
             }
 
             /**
@@ -259,7 +292,7 @@ namespace local
              */
             virtual void setIllegal(const T& value)
             {
-                if( Self::isConstructed() )
+                if( Construction::isConstructed(*this) )
                 {
                     illegal_ = value;
                 }
@@ -273,7 +306,7 @@ namespace local
              */
             virtual bool isIllegal(const T& value) const
             {
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return false;
                 }
@@ -313,7 +346,7 @@ namespace local
             virtual library::Buffer<T,0,A>* array() const
             {
                 #ifdef EOOS_NO_STRICT_MISRA_RULES
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return NULL;
                 }
@@ -350,6 +383,20 @@ namespace local
                 return this->getListIterator(0);
             }
 
+            #ifdef EOOS_COUNTERS
+
+            /**
+             * Returns counters of this list operations.
+             *
+             * @return the counters.
+             */
+            const Counters& getCounters() const
+            {
+                return counters_;
+            }
+
+            #endif // EOOS_COUNTERS
+
         protected:
 
             /**
@@ -363,20 +410,23 @@ namespace local
              */
             bool addNode(const int32 index, const T& element)
             {
+                LIBRARY_PROFILE(LIST_ADD);
                 if(isIndexOutOfBounds(index))
                 {
                     return false;
                 }
-                Node* const node = new Node(element);
+                Node* const node = createNode(element);
                 if(node == NULL || not node->isConstructed())
                 {
-                    delete node;
+                    deleteNode(node);
                     return false;
                 }
                 if(last_ == NULL)
                 {
                     last_ = node;
                     count_++;
+                    LIBRARY_COUNT(counters_, NODES_RENUMBERED, getLength() - 1 - index);
+                    LIBRARY_TRACE(LIST_ADD, index, getLength());
                     return true;
                 }
                 if(index > 0)
@@ -384,7 +434,7 @@ namespace local
                     Node* const after = getNodeByIndex(index - 1);
                     if(after == NULL)
                     {
-                        delete node;
+                        deleteNode(node);
                         return false;
                     }
                     after->insertAfter(node);
@@ -398,12 +448,14 @@ namespace local
                     Node* const before = getNodeByIndex(0);
                     if(before == NULL)
                     {
-                        delete node;
+                        deleteNode(node);
                         return false;
                     }
                     before->insertBefore(node);
                 }
                 count_++;
+                LIBRARY_COUNT(counters_, NODES_RENUMBERED, getLength() - 1 - index);
+                LIBRARY_TRACE(LIST_ADD, index, getLength());
                 return true;
             }
 
@@ -415,11 +467,13 @@ namespace local
              */
             Node* getNodeByIndex(const int32 index) const
             {
-                if( not isIndex(index) )
+                // The number of nodes is not taken by the virtual functions as the function is called for each access
+                const int32 length = getNodesNumber();
+                if(index < 0 || index >= length)
                 {
                     return NULL;
                 }
-                if(index == getLength() - 1)
+                if(index == length - 1)
                 {
                     return last_;
                 }
@@ -428,9 +482,20 @@ namespace local
                 {
                     node = node->getNext();
                 }
+                LIBRARY_COUNT(counters_, NODES_TRAVERSED, index);
                 return node;
             }
 
+            /**
+             * Returns a number of nodes of this list.
+             *
+             * @return number of nodes.
+             */
+            int32 getNodesNumber() const
+            {
+                return last_ == NULL ? 0 : last_->getIndex() + 1;
+            }
+
             /**
              * Returns a node of this list by element.
              *
@@ -451,8 +516,10 @@ namespace local
                     {
                         continue;
                     }
+                    LIBRARY_COUNT(counters_, NODES_TRAVERSED, i + 1);
                     return node;
                 }
+                LIBRARY_COUNT(counters_, NODES_TRAVERSED, len);
                 return NULL;
             }
 
@@ -464,10 +531,12 @@ namespace local
              */
             bool removeNode(Node* const node)
             {
+                LIBRARY_PROFILE(LIST_REMOVE);
                 if(node == NULL)
                 {
                     return false;
                 }
+                LIBRARY_COUNT(counters_, NODES_RENUMBERED, getLength() - 1 - node->getIndex());
                 if(node == last_)
                 {
                     if(getLength() == 1)
@@ -479,8 +548,9 @@ namespace local
                         last_ = last_->getPrevious();
                     }
                 }
-                delete node;
+                deleteNode(node);
                 count_++;
+                LIBRARY_TRACE(LIST_REMOVE, getLength(), 0);
                 return true;
             }
 
@@ -525,8 +595,61 @@ namespace local
                 return illegal_;
             }
 
+            #if defined(EOOS_NO_STRICT_MISRA_RULES) && __cplusplus >= 201103L
+
+            /**
+             * Moves nodes of a passed list to this list.
+             *
+             * Iterators of both the lists become invalid after the call.
+             *
+             * @param obj - a source object which is empty after the call.
+             */
+            void move(AbstractLinkedList<T,A>& obj)
+            {
+                if( Construction::isConstructed(*this) && obj.isConstructed() && &obj != this )
+                {
+                    clear();
+                    // Take the allocation of the source nodes for deleting them
+                    library::Allocation<A>::operator=(obj);
+                    illegal_ = obj.illegal_;
+                    last_ = obj.last_;
+                    obj.last_ = NULL;
+                    count_++;
+                    obj.count_++;
+                }
+            }
+
+            #endif // EOOS_NO_STRICT_MISRA_RULES && C++11
+
         private:
 
+            /**
+             * Creates a new node of this list.
+             *
+             * @param element an element of the node.
+             * @return pointer to the new node, or NULL if memory has not been allocated.
+             */
+            Node* createNode(const T& element)
+            {
+                LIBRARY_COUNT(counters_, NODES_ALLOCATED, 1);
+                void* const addr = library::Allocation<A>::allocate( sizeof(Node) );
+                return addr != NULL ? new (addr) Node(element) : NULL;
+            }
+
+            /**
+             * Deletes a node of this list.
+             *
+             * @param node pointer to the node or NULL.
+             */
+            void deleteNode(Node* const node)
+            {
+                if(node != NULL)
+                {
+                    node->~Node();
+                    library::Allocation<A>::free(node);
+                }
+            }
+
             /**
              * Copy constructor.
              *
@@ -557,6 +680,15 @@ namespace local
              */
             int32 count_;
 
+            #ifdef EOOS_COUNTERS
+
+            /**
+             * Counters of this list operations.
+             */
+            mutable Counters counters_;
+
+            #endif // EOOS_COUNTERS
+
         };
     }
 }
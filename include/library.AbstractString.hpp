@@ -7,6 +7,10 @@
  * The specialization allocates necessary memory size for containing the buffer
  * in a heap memory.
  *
+ * If the EOOS_SHARED_STRING macro is defined, the dynamic strings copied by
+ * the copy constructor or the assignment operator share one buffer counting
+ * its references, and a string gets own copy of the buffer only when it is modified.
+ *
  * @author    Sergey Baigudin, sergey@baigudin.software
  * @copyright 2017-2018, Sergey Baigudin, Baigudin Software
  * @license   http://embedded.team/license/
@@ -15,6 +19,13 @@
 #define LIBRARY_ABSTRACT_STRING_HPP_
 
 #include "library.AbstractBaseString.hpp"
+#include "library.Unicode.hpp"
+#include "library.Allocation.hpp"
+#include "library.Profile.hpp"
+
+#ifdef EOOS_SHARED_STRING
+#include "library.Atomic.hpp"
+#endif // EOOS_SHARED_STRING
 
 namespace local
 {
@@ -38,6 +49,7 @@ namespace local
             using Parent::copy;
             using Parent::concatenate;
             using Parent::compare;
+            using Parent::replace;
 
             /**
              * Constructor.
@@ -78,45 +90,39 @@ namespace local
                 return context_.str;
             }
 
-        protected:
-
             /**
-             * Copies a passed string into this string.
+             * Replaces all occurrences of a passed string in this string.
              *
-             * @param str - a character string to be copied.
-             * @return true if a passed string has been copied successfully.
+             * @param target      - a character string to be replaced.
+             * @param replacement - a character string to replace with.
+             * @return true if the occurrences have been replaced successfully.
              */
-            virtual bool copy(const T* const str)
+            virtual bool replace(const T* const target, const T* const replacement)
             {
                 bool res;
-                if( Parent::isConstructed() && str != NULL )
+                if( Construction::isConstructed(*this) && context_.str != NULL && target != NULL && replacement != NULL )
                 {
-                    int32 const len = Parent::getLength(str);
+                    int32 const tlen = Parent::getLength(target);
+                    int32 const rlen = Parent::getLength(replacement);
+                    int32 const count = Parent::getCount(context_.str, context_.len, target, tlen);
+                    int32 const len = context_.len + count * (rlen - tlen);
                     res = true;
-                    // If a given string length is more than this max available length
-                    if( not context_.isFit(len) )
+                    if(count == 0)
                     {
-                        // Create a new temporary string context
-                        Context context;
-                        if( context.allocate(len) )
-                        {
-                            // Delete this string context
-                            context_.free();
-                            // Set new contex
-                            context_.mirror(context);
-                        }
-                        else
-                        {
-                            res = false;
-                        }
+                        // Nothing to be replaced
                     }
-                    else
+                    // If the resulting string fits to this buffer, do the replacement in place
+                    else if( context_.isFit(len) )
                     {
+                        // Move the string to the end of a resulting string if the string grows
+                        int32 const shift = len > context_.len ? len - context_.len : 0;
+                        Parent::move(&context_.str[shift], context_.str, context_.len);
+                        Parent::replace(context_.str, &context_.str[shift], context_.len, target, tlen, replacement, rlen);
                         context_.len = len;
                     }
-                    if(res == true)
+                    else
                     {
-                        Parent::copy(context_.str, str);
+                        res = false;
                     }
                 }
                 else
@@ -127,54 +133,161 @@ namespace local
             }
 
             /**
-             * Concatenates a passed string to this string.
+             * Copies characters into this string.
              *
-             * @param str - an character string to be appended.
-             * @return true if a passed string has been appended successfully.
+             * The characters are not needed to be terminated, and the length of them
+             * is not measured, so that a part of other string or buffer can be copied.
+             *
+             * @param str - a first character to be copied.
+             * @param len - a number of characters to be copied.
+             * @return true if the characters have been copied successfully.
              */
-            virtual bool concatenate(const T* const str)
+            bool copy(const T* const str, int32 const len)
             {
+                LIBRARY_PROFILE(STRING_COPY);
                 bool res;
-                if( Parent::isConstructed() && str != NULL )
+                // Copy a part of this string forward in place, as the part must not be terminated before copying
+                if( Construction::isConstructed(*this) && isPart(str) && len >= 0 && context_.isFit(len) )
+                {
+                    for(int32 i=0; i<len; i++)
+                    {
+                        context_.str[i] = str[i];
+                    }
+                    context_.len = len;
+                    context_.str[len] = this->getTerminator();
+                    res = true;
+                }
+                else
                 {
-                    // Simply, copy a given string if the context is freed
-                    if( not context_.isAllocated() )
+                    T* const dst = str != NULL ? reserve(0, len) : NULL;
+                    if(dst == NULL)
                     {
-                        res = Self::copy(str);
+                        res = false;
                     }
                     else
                     {
-                        res = true;
-                        int32 const len = Parent::getLength(str) + context_.len;
-                        // If a length of this string plus a given string is more than this max available length
-                        if( not context_.isFit(len) )
+                        for(int32 i=0; i<len; i++)
                         {
-                            // Create a new temporary string context
-                            Context context;
-                            if( context.allocate(len) )
-                            {
-                                // Copy a string of this context to the new contex string
-                                Parent::copy(context.str, context_.str);
-                                // Delete this string context
-                                context_.free();
-                                // Set new contex
-                                context_.mirror(context);
-                            }
-                            else
-                            {
-                                res = false;
-                            }
-                        }
-                        else
-                        {
-                            context_.len = len;
-                        }
-                        if(res == true)
-                        {
-                            Parent::concatenate(context_.str, str);
+                            dst[i] = str[i];
                         }
+                        res = true;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates characters to this string.
+             *
+             * The characters are not needed to be terminated, and the length of them
+             * is not measured, so that a part of this or other string or buffer can be appended.
+             *
+             * @param str - a first character to be appended.
+             * @param len - a number of characters to be appended.
+             * @return true if the characters have been appended successfully.
+             */
+            bool concatenate(const T* const str, int32 const len)
+            {
+                LIBRARY_PROFILE(STRING_CONCATENATE);
+                bool res;
+                int32 const index = context_.len;
+                // Keep an offset of the characters being a part of this string, which might be relocated
+                bool const part = isPart(str);
+                intptr const offset = part ? str - context_.str : 0;
+                T* const dst = str != NULL ? reserve(index, len) : NULL;
+                if(dst == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    const T* const src = part ? &context_.str[offset] : str;
+                    for(int32 i=0; i<len; i++)
+                    {
+                        dst[i] = src[i];
+                    }
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Copies a Unicode string into this string transcoding its characters.
+             *
+             * Characters of a passed string and of this string are UTF-8, UTF-16 or UTF-32
+             * code units if sizes of their types are one, two or four bytes correspondingly.
+             * The passed string is validated and measured before this string is changed,
+             * so that the memory for the characters is allocated once.
+             *
+             * NOTE: You need to use "string.template transcode<U>(src, len);" syntax,
+             * if you have to specify the template argument type explicitly.
+             *
+             * @param src - a first code unit of a source string.
+             * @param len - a number of code units of the source string.
+             * @return true if the source string is valid and has been copied successfully.
+             */
+            template <typename U>
+            bool transcode(const U* const src, int32 const len)
+            {
+                bool res;
+                int32 const length = Unicode::transcode<U,T>(src, len, NULL);
+                if( not Construction::isConstructed(*this) || length < 0 )
+                {
+                    res = false;
+                }
+                else
+                {
+                    T* const str = reserve(0, length);
+                    if(str == NULL)
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        static_cast<void>( Unicode::transcode<U,T>(src, len, str) );
+                        res = true;
                     }
                 }
+                return res;
+            }
+
+        protected:
+
+            /**
+             * Copies a passed string into this string.
+             *
+             * @param str - a character string to be copied.
+             * @return true if a passed string has been copied successfully.
+             */
+            virtual bool copy(const T* const str)
+            {
+                bool res;
+                if( Construction::isConstructed(*this) && str != NULL )
+                {
+                    int32 const len = Parent::getLength(str);
+                    res = Self::copy(str, len);
+                }
+                else
+                {
+                    res = false;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates a passed string to this string.
+             *
+             * @param str - an character string to be appended.
+             * @return true if a passed string has been appended successfully.
+             */
+            virtual bool concatenate(const T* const str)
+            {
+                bool res;
+                if( Construction::isConstructed(*this) && str != NULL )
+                {
+                    int32 const len = Parent::getLength(str);
+                    res = Self::concatenate(str, len);
+                }
                 else
                 {
                     res = false;
@@ -194,7 +307,7 @@ namespace local
             virtual int32 compare(const T* const str) const
             {
                 int32 res;
-                if( Parent::isConstructed() && context_.str != NULL && str != NULL )
+                if( Construction::isConstructed(*this) && context_.str != NULL && str != NULL )
                 {
                     res = context_.len - Parent::getLength(str);
                     // If lengths are equal, characters might be different
@@ -219,8 +332,58 @@ namespace local
                 return res;
             }
 
+            /**
+             * Prepares this string for containing a number of characters after an index.
+             *
+             * Characters preceding the index are kept, and this string is terminated
+             * after the characters being prepared. The characters being prepared
+             * are not initialized and have to be written by a caller.
+             *
+             * @param index  - an index of the first character being prepared, which is not greater than this length.
+             * @param length - a number of characters being prepared.
+             * @return pointer to the character of the index, or NULL if this string cannot contain the characters.
+             */
+            T* reserve(int32 const index, int32 const length)
+            {
+                T* res;
+                int32 const len = index + length;
+                if( not Construction::isConstructed(*this) || index < 0 || length < 0 || index > context_.len )
+                {
+                    res = NULL;
+                }
+                else if( not context_.isAllocated() )
+                {
+                    res = context_.allocate(len) ? context_.str : NULL;
+                }
+                else if( context_.isFit(len) )
+                {
+                    res = &context_.str[index];
+                    context_.len = len;
+                }
+                else
+                {
+                    res = NULL;
+                }
+                if(res != NULL)
+                {
+                    context_.str[len] = this->getTerminator();
+                }
+                return res;
+            }
+
         private:
 
+            /**
+             * Tests if characters are a part of this string.
+             *
+             * @param str - a first character.
+             * @return true if the character is contained in this string.
+             */
+            bool isPart(const T* const str) const
+            {
+                return context_.str != NULL && str >= context_.str && str < &context_.str[context_.len] ? true : false;
+            }
+
             /**
              * Constructor.
              *
@@ -422,6 +585,7 @@ namespace local
             using Parent::copy;
             using Parent::concatenate;
             using Parent::compare;
+            using Parent::replace;
 
             /**
              * Constructor.
@@ -430,6 +594,15 @@ namespace local
                 context_ (){
             }
 
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this string characters.
+             */
+            explicit AbstractString(const library::Allocation<A>& allocation) : Parent(),
+                context_ (allocation){
+            }
+
             /**
              * Destructor.
              */
@@ -445,7 +618,7 @@ namespace local
              */
             virtual int32 getLength() const
             {
-                return Parent::isConstructed() ? context_.len : 0;
+                return Construction::isConstructed(*this) ? context_.len : 0;
             }
 
             /**
@@ -462,28 +635,45 @@ namespace local
                 return context_.str;
             }
 
-        protected:
-
             /**
-             * Copies a passed string into this string.
+             * Replaces all occurrences of a passed string in this string.
              *
-             * @param str - a character string to be copied.
-             * @return true if a passed string has been copied successfully.
+             * @param target      - a character string to be replaced.
+             * @param replacement - a character string to replace with.
+             * @return true if the occurrences have been replaced successfully.
              */
-            virtual bool copy(const T* const str)
+            virtual bool replace(const T* const target, const T* const replacement)
             {
                 bool res;
-                if( Parent::isConstructed() && str != NULL )
+                if( Construction::isConstructed(*this) && context_.str != NULL && target != NULL && replacement != NULL )
                 {
-                    int32 const len = Parent::getLength(str);
+                    int32 const tlen = Parent::getLength(target);
+                    int32 const rlen = Parent::getLength(replacement);
+                    int32 const count = Parent::getCount(context_.str, context_.len, target, tlen);
+                    int32 const len = context_.len + count * (rlen - tlen);
                     res = true;
-                    // If a given string length is more than this max available length
-                    if( not context_.isFit(len) )
+                    if(count == 0)
+                    {
+                        // Nothing to be replaced
+                    }
+                    // If the resulting string fits to this buffer, do the replacement in place
+                    else if( context_.isFit(len) )
+                    {
+                        // Move the string to the end of a resulting string if the string grows
+                        int32 const shift = len > context_.len ? len - context_.len : 0;
+                        Parent::move(&context_.str[shift], context_.str, context_.len);
+                        Parent::replace(context_.str, &context_.str[shift], context_.len, target, tlen, replacement, rlen);
+                        context_.len = len;
+                    }
+                    else
                     {
                         // Create a new temporary string context
-                        Context context;
+                        Context context( context_.getAllocation() );
                         if( context.allocate(len) )
                         {
+                            LIBRARY_COUNT(this->counters_, STRINGS_ALLOCATED, 1);
+                            // Write a resulting string to the new context string
+                            Parent::replace(context.str, context_.str, context_.len, target, tlen, replacement, rlen);
                             // Delete this string context
                             context_.free();
                             // Set new contex
@@ -494,71 +684,170 @@ namespace local
                             res = false;
                         }
                     }
-                    else
+                }
+                else
+                {
+                    res = false;
+                }
+                return res;
+            }
+
+            /**
+             * Copies characters into this string.
+             *
+             * The characters are not needed to be terminated, and the length of them
+             * is not measured, so that a part of other string or buffer can be copied.
+             *
+             * @param str - a first character to be copied.
+             * @param len - a number of characters to be copied.
+             * @return true if the characters have been copied successfully.
+             */
+            bool copy(const T* const str, int32 const len)
+            {
+                LIBRARY_PROFILE(STRING_COPY);
+                bool res;
+                // Copy a part of this string forward in place, as the part must not be terminated before copying
+                if( Construction::isConstructed(*this) && isPart(str) && len >= 0 && context_.isFit(len) )
+                {
+                    for(int32 i=0; i<len; i++)
                     {
-                        context_.len = len;
+                        context_.str[i] = str[i];
+                    }
+                    context_.len = len;
+                    context_.str[len] = this->getTerminator();
+                    res = true;
+                }
+                else
+                {
+                    T* const dst = str != NULL ? reserve(0, len) : NULL;
+                    if(dst == NULL)
+                    {
+                        res = false;
                     }
-                    if(res == true)
+                    else
                     {
-                        Parent::copy(context_.str, str);
+                        for(int32 i=0; i<len; i++)
+                        {
+                            dst[i] = str[i];
+                        }
+                        res = true;
                     }
                 }
-                else
+                return res;
+            }
+
+            /**
+             * Concatenates characters to this string.
+             *
+             * The characters are not needed to be terminated, and the length of them
+             * is not measured, so that a part of this or other string or buffer can be appended.
+             *
+             * @param str - a first character to be appended.
+             * @param len - a number of characters to be appended.
+             * @return true if the characters have been appended successfully.
+             */
+            bool concatenate(const T* const str, int32 const len)
+            {
+                LIBRARY_PROFILE(STRING_CONCATENATE);
+                bool res;
+                int32 const index = context_.len;
+                // Keep an offset of the characters being a part of this string, which might be relocated
+                bool const part = isPart(str);
+                intptr const offset = part ? str - context_.str : 0;
+                T* const dst = str != NULL ? reserve(index, len) : NULL;
+                if(dst == NULL)
                 {
                     res = false;
                 }
+                else
+                {
+                    const T* const src = part ? &context_.str[offset] : str;
+                    for(int32 i=0; i<len; i++)
+                    {
+                        dst[i] = src[i];
+                    }
+                    res = true;
+                }
                 return res;
             }
 
             /**
-             * Concatenates a passed string to this string.
+             * Copies a Unicode string into this string transcoding its characters.
              *
-             * @param str - an character string to be appended.
-             * @return true if a passed string has been appended successfully.
+             * Characters of a passed string and of this string are UTF-8, UTF-16 or UTF-32
+             * code units if sizes of their types are one, two or four bytes correspondingly.
+             * The passed string is validated and measured before this string is changed,
+             * so that the memory for the characters is allocated once.
+             *
+             * NOTE: You need to use "string.template transcode<U>(src, len);" syntax,
+             * if you have to specify the template argument type explicitly.
+             *
+             * @param src - a first code unit of a source string.
+             * @param len - a number of code units of the source string.
+             * @return true if the source string is valid and has been copied successfully.
              */
-            virtual bool concatenate(const T* const str)
+            template <typename U>
+            bool transcode(const U* const src, int32 const len)
             {
                 bool res;
-                if( Parent::isConstructed() && str != NULL )
+                int32 const length = Unicode::transcode<U,T>(src, len, NULL);
+                if( not Construction::isConstructed(*this) || length < 0 )
+                {
+                    res = false;
+                }
+                else
                 {
-                    // Simply, copy a given string if the context is freed
-                    if( not context_.isAllocated() )
+                    T* const str = reserve(0, length);
+                    if(str == NULL)
                     {
-                        res = Self::copy(str);
+                        res = false;
                     }
                     else
                     {
+                        static_cast<void>( Unicode::transcode<U,T>(src, len, str) );
                         res = true;
-                        int32 const len = Parent::getLength(str) + context_.len;
-                        // If a length of this string plus a given string is more than this max available length
-                        if( not context_.isFit(len) )
-                        {
-                            // Create a new temporary string context
-                            Context context;
-                            if( context.allocate(len) )
-                            {
-                                // Copy a string of this context to the new contex string
-                                Parent::copy(context.str, context_.str);
-                                // Delete this string context
-                                context_.free();
-                                // Set new contex
-                                context_.mirror(context);
-                            }
-                            else
-                            {
-                                res = false;
-                            }
-                        }
-                        else
-                        {
-                            context_.len = len;
-                        }
-                        if(res == true)
-                        {
-                            Parent::concatenate(context_.str, str);
-                        }
                     }
                 }
+                return res;
+            }
+
+        protected:
+
+            /**
+             * Copies a passed string into this string.
+             *
+             * @param str - a character string to be copied.
+             * @return true if a passed string has been copied successfully.
+             */
+            virtual bool copy(const T* const str)
+            {
+                bool res;
+                if( Construction::isConstructed(*this) && str != NULL )
+                {
+                    int32 const len = Parent::getLength(str);
+                    res = Self::copy(str, len);
+                }
+                else
+                {
+                    res = false;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates a passed string to this string.
+             *
+             * @param str - an character string to be appended.
+             * @return true if a passed string has been appended successfully.
+             */
+            virtual bool concatenate(const T* const str)
+            {
+                bool res;
+                if( Construction::isConstructed(*this) && str != NULL )
+                {
+                    int32 const len = Parent::getLength(str);
+                    res = Self::concatenate(str, len);
+                }
                 else
                 {
                     res = false;
@@ -578,7 +867,7 @@ namespace local
             virtual int32 compare(const T* const str) const
             {
                 int32 res;
-                if( Parent::isConstructed() && context_.str != NULL && str != NULL )
+                if( Construction::isConstructed(*this) && context_.str != NULL && str != NULL )
                 {
                     res = context_.len - Parent::getLength(str);
                     // If lengths are equal, characters might be different
@@ -603,8 +892,135 @@ namespace local
                 return res;
             }
 
+            /**
+             * Shares characters of a passed string with this string.
+             *
+             * If the EOOS_SHARED_STRING macro is defined, the strings refer to
+             * the same buffer of characters until one of them is modified.
+             * Otherwise, the characters are copied into this string.
+             *
+             * @param obj - a source object.
+             * @return true if a passed string has been shared successfully.
+             */
+            bool share(const library::AbstractString<T,0,A>& obj)
+            {
+                bool res;
+                #ifdef EOOS_SHARED_STRING
+                if( not Construction::isConstructed(*this) || not obj.isConstructed() )
+                {
+                    res = false;
+                }
+                // Characters allocated by another heap are copied,
+                // as they are freed by the heap of their last owner
+                else if( context_.getAllocation() != obj.context_.getAllocation() )
+                {
+                    res = Parent::copy(obj);
+                }
+                else
+                {
+                    if(&obj != this)
+                    {
+                        // Delete this string context
+                        context_.free();
+                        // Refer to the source string context
+                        context_.share(obj.context_);
+                    }
+                    res = true;
+                }
+                #else
+                res = Parent::copy(obj);
+                #endif // EOOS_SHARED_STRING
+                return res;
+            }
+
+            /**
+             * Prepares this string for containing a number of characters after an index.
+             *
+             * Characters preceding the index are kept, and this string is terminated
+             * after the characters being prepared. The characters being prepared
+             * are not initialized and have to be written by a caller.
+             *
+             * @param index  - an index of the first character being prepared, which is not greater than this length.
+             * @param length - a number of characters being prepared.
+             * @return pointer to the character of the index, or NULL if this string cannot contain the characters.
+             */
+            T* reserve(int32 const index, int32 const length)
+            {
+                T* res;
+                int32 const len = index + length;
+                if( not Construction::isConstructed(*this) || index < 0 || length < 0 || index > context_.len )
+                {
+                    res = NULL;
+                }
+                else if( context_.isAllocated() && context_.isFit(len) )
+                {
+                    res = &context_.str[index];
+                    context_.len = len;
+                }
+                else
+                {
+                    // Create a new temporary string context
+                    Context context( context_.getAllocation() );
+                    if( context.allocate(len) )
+                    {
+                        LIBRARY_COUNT(this->counters_, STRINGS_ALLOCATED, 1);
+                        // Copy the kept characters of this context to the new contex string
+                        for(int32 i=0; i<index; i++)
+                        {
+                            context.str[i] = context_.str[i];
+                        }
+                        res = &context.str[index];
+                        // Delete this string context
+                        context_.free();
+                        // Set new contex
+                        context_.mirror(context);
+                    }
+                    else
+                    {
+                        res = NULL;
+                    }
+                }
+                if(res != NULL)
+                {
+                    context_.str[len] = this->getTerminator();
+                }
+                return res;
+            }
+
+            #if __cplusplus >= 201103L
+
+            /**
+             * Moves characters of a passed string to this string.
+             *
+             * @param obj - a source object which is empty after the call.
+             */
+            void move(library::AbstractString<T,0,A>& obj)
+            {
+                if( Construction::isConstructed(*this) && obj.isConstructed() && &obj != this )
+                {
+                    // Delete this string context
+                    context_.free();
+                    // Take the source string context
+                    context_.mirror(obj.context_);
+                    obj.context_.reset();
+                }
+            }
+
+            #endif // C++11
+
         private:
 
+            /**
+             * Tests if characters are a part of this string.
+             *
+             * @param str - a first character.
+             * @return true if the character is contained in this string.
+             */
+            bool isPart(const T* const str) const
+            {
+                return context_.str != NULL && str >= context_.str && str < &context_.str[context_.len] ? true : false;
+            }
+
             /**
              * Constructor.
              *
@@ -632,7 +1048,7 @@ namespace local
             /**
              * A contex of this class containing string.
              */
-            struct Context
+            struct Context : public library::Allocation<A>
             {
 
             public:
@@ -655,7 +1071,18 @@ namespace local
                 /**
                  * Constructor.
                  */
-                Context() :
+                Context() : library::Allocation<A>(),
+                    str (NULL),
+                    len (0),
+                    max (0){
+                }
+
+                /**
+                 * Constructor.
+                 *
+                 * @param allocation - an allocation of the characters.
+                 */
+                explicit Context(const library::Allocation<A>& allocation) : library::Allocation<A>(allocation),
                     str (NULL),
                     len (0),
                     max (0){
@@ -682,6 +1109,18 @@ namespace local
                     str = obj.str;
                     len = obj.len;
                     max = obj.max;
+                    // The characters are freed by their allocation
+                    library::Allocation<A>::operator=(obj);
+                }
+
+                /**
+                 * Returns the allocation of this context characters.
+                 *
+                 * @return the allocation.
+                 */
+                const library::Allocation<A>& getAllocation() const
+                {
+                    return *this;
                 }
 
                 /**
@@ -698,7 +1137,11 @@ namespace local
                         // Calculate size in byte for the given length
                         int32 const size = calculateSize(length);
                         // Allocate a new array
-                        T* const string = reinterpret_cast<T*>( A::allocate(size) );
+                        #ifdef EOOS_SHARED_STRING
+                        T* const string = createShared(size);
+                        #else
+                        T* const string = reinterpret_cast<T*>( library::Allocation<A>::allocate(size) );
+                        #endif // EOOS_SHARED_STRING
                         if(string == NULL)
                         {
                             res = false;
@@ -726,13 +1169,70 @@ namespace local
                 {
                     if(str != NULL)
                     {
-                        A::free(str);
+                        #ifdef EOOS_SHARED_STRING
+                        deleteShared(str);
+                        #else
+                        library::Allocation<A>::free(str);
+                        #endif // EOOS_SHARED_STRING
                         str = NULL;
                         len = 0;
                         max = 0;
                     }
                 }
 
+                /**
+                 * Resets this context without freeing its characters.
+                 *
+                 * The function is called when the characters have been mirrored to another context.
+                 */
+                void reset()
+                {
+                    str = NULL;
+                    len = 0;
+                    max = 0;
+                }
+
+                #ifdef EOOS_SHARED_STRING
+
+                /**
+                 * Refers this freed context to characters of another context.
+                 *
+                 * @param obj - a source object.
+                 */
+                void share(const Context& obj)
+                {
+                    str = obj.str;
+                    len = obj.len;
+                    max = obj.max;
+                    if(str != NULL)
+                    {
+                        Header* const header = getHeader(str);
+                        static_cast<void>( header->refs.fetchAdd(1, library::AtomicBase::RELAXED) );
+                    }
+                }
+
+                /**
+                 * Tests if characters of this context are referred by another context.
+                 *
+                 * @return true if the characters are shared.
+                 */
+                bool isShared() const
+                {
+                    bool res;
+                    if(str == NULL)
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        Header* const header = getHeader(str);
+                        res = header->refs.load(library::AtomicBase::ACQUIRE) > 1 ? true : false;
+                    }
+                    return res;
+                }
+
+                #endif // EOOS_SHARED_STRING
+
                 /**
                  * Test if this contex is allocated.
                  *
@@ -765,6 +1265,14 @@ namespace local
                     {
                         res = false;
                     }
+                    #ifdef EOOS_SHARED_STRING
+                    // Shared characters must not be modified, so that
+                    // a modified string has to have own new buffer
+                    else if( isShared() )
+                    {
+                        res = false;
+                    }
+                    #endif // EOOS_SHARED_STRING
                     else
                     {
                         res = true;
@@ -774,6 +1282,100 @@ namespace local
 
             private:
 
+                #ifdef EOOS_SHARED_STRING
+
+                /**
+                 * Header of a shared buffer of characters.
+                 *
+                 * The header precedes the characters, and its size is eight
+                 * for keeping the characters aligned to eight.
+                 */
+                struct Header
+                {
+                    /**
+                     * Constructor.
+                     */
+                    Header() :
+                        refs  (1),
+                        align (0){
+                    }
+
+                    /**
+                     * Operator new.
+                     *
+                     * @param size - unused.
+                     * @param ptr  - address of memory.
+                     * @return address of memory.
+                     */
+                    void* operator new(size_t, void* const ptr)
+                    {
+                        return ptr;
+                    }
+
+                    /**
+                     * Number of contexts referring to the characters.
+                     */
+                    library::Atomic<int32> refs;
+
+                    /**
+                     * Aligning data.
+                     */
+                    int32 align;
+
+                };
+
+                /**
+                 * Allocates a shared buffer of characters.
+                 *
+                 * @param size - size in byte of the characters.
+                 * @return the first character of the buffer, or NULL if an error has been occurred.
+                 */
+                T* createShared(int32 const size) const
+                {
+                    T* string;
+                    void* const addr = library::Allocation<A>::allocate( static_cast<size_t>(size) + sizeof(Header) );
+                    if(addr == NULL)
+                    {
+                        string = NULL;
+                    }
+                    else
+                    {
+                        Header* const header = new (addr) Header();
+                        string = reinterpret_cast<T*>(&header[1]);
+                    }
+                    return string;
+                }
+
+                /**
+                 * Releases a shared buffer of characters.
+                 *
+                 * The buffer is freed when the last context refers to it has been released.
+                 *
+                 * @param string - the first character of the buffer.
+                 */
+                void deleteShared(T* const string) const
+                {
+                    Header* const header = getHeader(string);
+                    if( header->refs.fetchSub(1, library::AtomicBase::ACQ_REL) == 1 )
+                    {
+                        library::Allocation<A>::free(header);
+                    }
+                }
+
+                /**
+                 * Returns a header of a shared buffer of characters.
+                 *
+                 * @param string - the first character of the buffer.
+                 * @return the buffer header.
+                 */
+                static Header* getHeader(T* const string)
+                {
+                    Header* const header = reinterpret_cast<Header*>(string);
+                    return &header[-1];
+                }
+
+                #endif // EOOS_SHARED_STRING
+
                 /**
                  * Returns size in byte for a string length.
                  *
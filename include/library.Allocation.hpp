@@ -0,0 +1,180 @@
+/**
+ * Memory allocation of containers.
+ *
+ * Containers allocate memory of their elements through an object of this class.
+ * The primary template calls the static functions of an allocator class and has
+ * no data, so that containers derived from it are not enlarged, and the calls
+ * cost nothing in addition. The specialization for the instance allocator refers
+ * to a heap, and memory is allocated in the heap, or by the static functions
+ * if no heap is referred.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_ALLOCATION_HPP_
+#define LIBRARY_ALLOCATION_HPP_
+
+#include "library.InstanceAllocator.hpp"
+#include "api.Heap.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param A - heap memory allocator class.
+         */
+        template <class A = Allocator>
+        class Allocation
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            Allocation()
+            {
+            }
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            void* allocate(size_t const size) const
+            {
+                return A::allocate(size);
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            void free(void* const ptr) const
+            {
+                A::free(ptr);
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed object is freed by each of them.
+             *
+             * @param obj - a compared object.
+             * @return true.
+             */
+            bool operator==(const Allocation<A>&) const
+            {
+                return true;
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed object is not freed by each of them.
+             *
+             * @param obj - a compared object.
+             * @return false.
+             */
+            bool operator!=(const Allocation<A>&) const
+            {
+                return false;
+            }
+
+        };
+
+        /**
+         * Partial specialization of the template allocating memory in a heap.
+         *
+         * @param A - heap memory allocator class used when no heap is referred.
+         */
+        template <class A>
+        class Allocation< InstanceAllocator<A> >
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            Allocation() :
+                heap_ (NULL){
+            }
+
+            /**
+             * Constructor.
+             *
+             * The constructor is not explicit, so that a heap is passed
+             * to constructors of containers instead of an allocation.
+             *
+             * NOTE: A passed heap has to exist until memory allocated in it is freed.
+             *
+             * @param heap - a heap memory.
+             */
+            Allocation(api::Heap& heap) :
+                heap_ (&heap){
+            }
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            void* allocate(size_t const size) const
+            {
+                return heap_ != NULL ? heap_->allocate(size, NULL) : A::allocate(size);
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            void free(void* const ptr) const
+            {
+                if(heap_ != NULL)
+                {
+                    heap_->free(ptr);
+                }
+                else
+                {
+                    A::free(ptr);
+                }
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed object is freed by each of them.
+             *
+             * @param obj - a compared object.
+             * @return true if the objects refer to the same heap.
+             */
+            bool operator==(const Allocation< InstanceAllocator<A> >& obj) const
+            {
+                return heap_ == obj.heap_ ? true : false;
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed object is not freed by each of them.
+             *
+             * @param obj - a compared object.
+             * @return true if the objects refer to different heaps.
+             */
+            bool operator!=(const Allocation< InstanceAllocator<A> >& obj) const
+            {
+                return heap_ != obj.heap_ ? true : false;
+            }
+
+        private:
+
+            /**
+             * The heap memory, or NULL for the static allocator.
+             */
+            api::Heap* heap_;
+
+        };
+    }
+}
+#endif // LIBRARY_ALLOCATION_HPP_
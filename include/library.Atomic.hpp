@@ -0,0 +1,577 @@
+/**
+ * Atomic variables and memory fences.
+ *
+ * The operations are implemented by the atomic built-in functions of GCC
+ * compatible compilers, and each of them takes an order of memory accesses
+ * around it. The atomic pair class is defined if the compiler has a double-width
+ * compare-and-swap instruction for a target, which is shown by the defined
+ * LIBRARY_ATOMIC_PAIR macro; for example, x86-64 code has to be compiled with
+ * the -mcx16 option.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_ATOMIC_HPP_
+#define LIBRARY_ATOMIC_HPP_
+
+#include "Types.hpp"
+
+#if __SIZEOF_POINTER__ == 8 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#define LIBRARY_ATOMIC_PAIR
+#elif __SIZEOF_POINTER__ == 4 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#define LIBRARY_ATOMIC_PAIR
+#endif // __SIZEOF_POINTER__
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Memory orders and fences of atomic operations.
+         */
+        class AtomicBase
+        {
+
+        public:
+
+            /**
+             * Orders of memory accesses around an atomic operation.
+             */
+            enum Order
+            {
+                /**
+                 * No order is imposed, only the operation is atomic.
+                 */
+                RELAXED = __ATOMIC_RELAXED,
+
+                /**
+                 * Accesses depending on a loaded value are not reordered before the load.
+                 */
+                CONSUME = __ATOMIC_CONSUME,
+
+                /**
+                 * Accesses are not reordered before a load.
+                 */
+                ACQUIRE = __ATOMIC_ACQUIRE,
+
+                /**
+                 * Accesses are not reordered after a store.
+                 */
+                RELEASE = __ATOMIC_RELEASE,
+
+                /**
+                 * Both acquire and release orders of a read-modify-write operation.
+                 */
+                ACQ_REL = __ATOMIC_ACQ_REL,
+
+                /**
+                 * The acquire and release orders, and one total order of all such operations.
+                 */
+                SEQ_CST = __ATOMIC_SEQ_CST
+            };
+
+            /**
+             * Orders memory accesses of threads.
+             *
+             * @param order - an order of the fence.
+             */
+            static void fence(Order const order = SEQ_CST)
+            {
+                __atomic_thread_fence(order);
+            }
+
+            /**
+             * Orders memory accesses of a thread and signal handlers or interrupts on the same core.
+             *
+             * The fence prevents a compiler from reordering the accesses, and no instruction is emitted.
+             *
+             * @param order - an order of the fence.
+             */
+            static void signalFence(Order const order = SEQ_CST)
+            {
+                __atomic_signal_fence(order);
+            }
+
+        protected:
+
+            /**
+             * Returns an order of a failed compare-and-swap for an order of a successful one.
+             *
+             * @param order - an order of the successful operation.
+             * @return the order of loading without storing.
+             */
+            static Order getFailureOrder(Order const order)
+            {
+                Order res;
+                if(order == ACQ_REL)
+                {
+                    res = ACQUIRE;
+                }
+                else if(order == RELEASE)
+                {
+                    res = RELAXED;
+                }
+                else
+                {
+                    res = order;
+                }
+                return res;
+            }
+
+        };
+
+        /**
+         * Primary template implements atomic integers.
+         *
+         * @param T - an integer type.
+         */
+        template <typename T>
+        class Atomic : public AtomicBase
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            Atomic() :
+                value_ (0){
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param value - an initial value.
+             */
+            explicit Atomic(T const value) :
+                value_ (value){
+            }
+
+            /**
+             * Tests if the operations are implemented without locks.
+             *
+             * @return true if the operations are lock-free.
+             */
+            static bool isLockFree()
+            {
+                return __atomic_always_lock_free(sizeof(T), 0) ? true : false;
+            }
+
+            /**
+             * Loads the value.
+             *
+             * @param order - an order of the operation.
+             * @return the value.
+             */
+            T load(Order const order = SEQ_CST) const
+            {
+                return __atomic_load_n(&value_, order);
+            }
+
+            /**
+             * Stores a value.
+             *
+             * @param value - a new value.
+             * @param order - an order of the operation.
+             */
+            void store(T const value, Order const order = SEQ_CST)
+            {
+                __atomic_store_n(&value_, value, order);
+            }
+
+            /**
+             * Replaces the value.
+             *
+             * @param value - a new value.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T exchange(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_exchange_n(&value_, value, order);
+            }
+
+            /**
+             * Replaces the value if it equals to an expected value.
+             *
+             * @param expected - an expected value, which is set to the current value if they are not equal.
+             * @param desired  - a new value.
+             * @param order    - an order of the operation.
+             * @return true if the value has been replaced.
+             */
+            bool compareExchange(T& expected, T const desired, Order const order = SEQ_CST)
+            {
+                return __atomic_compare_exchange_n(&value_, &expected, desired, false, order, getFailureOrder(order));
+            }
+
+            /**
+             * Replaces the value if it equals to an expected value, or might fail spuriously.
+             *
+             * The function is faster than the strong one on some processors and
+             * has to be called in a loop.
+             *
+             * @param expected - an expected value, which is set to the current value if the value is not replaced.
+             * @param desired  - a new value.
+             * @param order    - an order of the operation.
+             * @return true if the value has been replaced.
+             */
+            bool compareExchangeWeak(T& expected, T const desired, Order const order = SEQ_CST)
+            {
+                return __atomic_compare_exchange_n(&value_, &expected, desired, true, order, getFailureOrder(order));
+            }
+
+            /**
+             * Adds a value.
+             *
+             * @param value - an addend.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T fetchAdd(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_add(&value_, value, order);
+            }
+
+            /**
+             * Subtracts a value.
+             *
+             * @param value - a subtrahend.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T fetchSub(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_sub(&value_, value, order);
+            }
+
+            /**
+             * Performs bitwise AND with a value.
+             *
+             * @param value - an operand.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T fetchAnd(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_and(&value_, value, order);
+            }
+
+            /**
+             * Performs bitwise OR with a value.
+             *
+             * @param value - an operand.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T fetchOr(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_or(&value_, value, order);
+            }
+
+            /**
+             * Performs bitwise exclusive OR with a value.
+             *
+             * @param value - an operand.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T fetchXor(T const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_xor(&value_, value, order);
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            Atomic(const Atomic<T>& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            Atomic<T>& operator=(const Atomic<T>& obj);
+
+            /**
+             * The value.
+             */
+            T value_;
+
+        };
+
+        /**
+         * Partial specialization of the template implements atomic pointers.
+         *
+         * @param T - a type of pointed objects.
+         */
+        template <typename T>
+        class Atomic<T*> : public AtomicBase
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            Atomic() :
+                value_ (NULL){
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param value - an initial value.
+             */
+            explicit Atomic(T* const value) :
+                value_ (value){
+            }
+
+            /**
+             * Tests if the operations are implemented without locks.
+             *
+             * @return true if the operations are lock-free.
+             */
+            static bool isLockFree()
+            {
+                return __atomic_always_lock_free(sizeof(T*), 0) ? true : false;
+            }
+
+            /**
+             * Loads the value.
+             *
+             * @param order - an order of the operation.
+             * @return the value.
+             */
+            T* load(Order const order = SEQ_CST) const
+            {
+                return __atomic_load_n(&value_, order);
+            }
+
+            /**
+             * Stores a value.
+             *
+             * @param value - a new value.
+             * @param order - an order of the operation.
+             */
+            void store(T* const value, Order const order = SEQ_CST)
+            {
+                __atomic_store_n(&value_, value, order);
+            }
+
+            /**
+             * Replaces the value.
+             *
+             * @param value - a new value.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T* exchange(T* const value, Order const order = SEQ_CST)
+            {
+                return __atomic_exchange_n(&value_, value, order);
+            }
+
+            /**
+             * Replaces the value if it equals to an expected value.
+             *
+             * @param expected - an expected value, which is set to the current value if they are not equal.
+             * @param desired  - a new value.
+             * @param order    - an order of the operation.
+             * @return true if the value has been replaced.
+             */
+            bool compareExchange(T*& expected, T* const desired, Order const order = SEQ_CST)
+            {
+                return __atomic_compare_exchange_n(&value_, &expected, desired, false, order, getFailureOrder(order));
+            }
+
+            /**
+             * Replaces the value if it equals to an expected value, or might fail spuriously.
+             *
+             * @param expected - an expected value, which is set to the current value if the value is not replaced.
+             * @param desired  - a new value.
+             * @param order    - an order of the operation.
+             * @return true if the value has been replaced.
+             */
+            bool compareExchangeWeak(T*& expected, T* const desired, Order const order = SEQ_CST)
+            {
+                return __atomic_compare_exchange_n(&value_, &expected, desired, true, order, getFailureOrder(order));
+            }
+
+            /**
+             * Advances the pointer by a number of objects.
+             *
+             * @param value - a number of objects.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T* fetchAdd(intptr const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_add(&value_, value * static_cast<intptr>( sizeof(T) ), order);
+            }
+
+            /**
+             * Moves the pointer back by a number of objects.
+             *
+             * @param value - a number of objects.
+             * @param order - an order of the operation.
+             * @return the previous value.
+             */
+            T* fetchSub(intptr const value, Order const order = SEQ_CST)
+            {
+                return __atomic_fetch_sub(&value_, value * static_cast<intptr>( sizeof(T) ), order);
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            Atomic(const Atomic<T*>& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            Atomic<T*>& operator=(const Atomic<T*>& obj);
+
+            /**
+             * The value.
+             */
+            T* value_;
+
+        };
+
+        #ifdef LIBRARY_ATOMIC_PAIR
+
+        /**
+         * Atomic pair of words replaced by the double-width compare-and-swap.
+         *
+         * The pair is used for a pointer with a counter of its changes,
+         * which prevents the ABA problem of lock-free structures.
+         * The operations are sequentially consistent.
+         */
+        class AtomicPair : public AtomicBase
+        {
+
+        public:
+
+            /**
+             * Value of the pair.
+             */
+            struct Value
+            {
+                /**
+                 * The first word.
+                 */
+                uintptr first;
+
+                /**
+                 * The second word.
+                 */
+                uintptr second;
+
+            };
+
+            /**
+             * Constructor.
+             */
+            AtomicPair()
+            {
+                value_.pair.first = 0;
+                value_.pair.second = 0;
+            }
+
+            /**
+             * Loads the value.
+             *
+             * @return the value.
+             */
+            Value load() const
+            {
+                // Replacing a value by the same value returns the current value atomically
+                Data data;
+                data.word = __sync_val_compare_and_swap(&value_.word, 0, 0);
+                return data.pair;
+            }
+
+            /**
+             * Replaces the value if it equals to an expected value.
+             *
+             * @param expected - an expected value, which is set to the current value if they are not equal.
+             * @param desired  - a new value.
+             * @return true if the value has been replaced.
+             */
+            bool compareExchange(Value& expected, const Value& desired)
+            {
+                Data exp;
+                Data des;
+                exp.pair = expected;
+                des.pair = desired;
+                Data cur;
+                cur.word = __sync_val_compare_and_swap(&value_.word, exp.word, des.word);
+                bool const res = cur.word == exp.word ? true : false;
+                expected = cur.pair;
+                return res;
+            }
+
+        private:
+
+            #if __SIZEOF_POINTER__ == 8
+            typedef unsigned __int128 Word;
+            #else
+            typedef uint64 Word;
+            #endif // __SIZEOF_POINTER__
+
+            /**
+             * The pair as a double-width word.
+             */
+            union Data
+            {
+                /**
+                 * The pair.
+                 */
+                Value pair;
+
+                /**
+                 * The word.
+                 */
+                Word word;
+
+            };
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            AtomicPair(const AtomicPair& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            AtomicPair& operator=(const AtomicPair& obj);
+
+            /**
+             * The value aligned to its size.
+             */
+            mutable Data value_ __attribute__ ((aligned (sizeof(Word))));
+
+        };
+
+        #endif // LIBRARY_ATOMIC_PAIR
+
+    }
+}
+#endif // LIBRARY_ATOMIC_HPP_
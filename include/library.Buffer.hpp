@@ -15,6 +15,7 @@
 #define LIBRARY_BUFFER_HPP_
 
 #include "library.AbstractBuffer.hpp"
+#include "library.Allocation.hpp"
 
 namespace local
 {
@@ -28,7 +29,7 @@ namespace local
          * @param A - heap memory allocator class.
          */
         template <typename T, int32 L, class A = Allocator>
-        class Buffer : public library::AbstractBuffer<T,A>
+        class Buffer LIBRARY_FINAL : public library::AbstractBuffer<T,A>
         {
             typedef library::AbstractBuffer<T,A> Parent;
 
@@ -89,6 +90,28 @@ namespace local
                 return *this;
             }
 
+            /**
+             * Returns an element of this buffer.
+             *
+             * NOTE: The operator hides the parent one for accessing the elements without calling virtual functions.
+             *
+             * @param index - an element index.
+             * @return an element.
+             */
+            T& operator[](const int32 index)
+            {
+                T* value;
+                if( not Construction::isConstructed(*this) || (index >= Parent::getLength()) || (buf_ == NULL) )
+                {
+                    value = &Parent::getIllegal();
+                }
+                else
+                {
+                    value = &buf_[index];
+                }
+                return *value;
+            }
+
         protected:
 
             /**
@@ -133,9 +156,10 @@ namespace local
          * @param A - heap memory allocator class.
          */
         template <typename T, class A>
-        class Buffer<T,0,A> : public AbstractBuffer<T,A>
+        class Buffer<T,0,A> LIBRARY_FINAL : public AbstractBuffer<T,A>, private Allocation<A>
         {
             typedef library::AbstractBuffer<T,A> ParentSpec1;
+            typedef library::Allocation<A>       ParentSpec2;
 
         public:
 
@@ -166,6 +190,35 @@ namespace local
                 this->setConstructed( isConstructed );
             }
 
+            /**
+             * Constructor.
+             *
+             * @param length     - count of buffer elements.
+             * @param allocation - an allocation of buffer elements, which is a heap for the instance allocator.
+             */
+            Buffer(int32 const length, const Allocation<A>& allocation) : ParentSpec1(length), ParentSpec2(allocation),
+                buf_       (NULL),
+                isDeleted_ (true){
+                const bool isConstructed = construct(length);
+                this->setConstructed( isConstructed );
+            }
+
+            /**
+             * Constructor.
+             *
+             * NOTE: A passed illegal element will be copied to an internal data of the class
+             *
+             * @param length     - count of buffer elements.
+             * @param illegal    - illegal value.
+             * @param allocation - an allocation of buffer elements, which is a heap for the instance allocator.
+             */
+            Buffer(int32 const length, const T& illegal, const Allocation<A>& allocation) : ParentSpec1(length, illegal), ParentSpec2(allocation),
+                buf_       (NULL),
+                isDeleted_ (true){
+                const bool isConstructed = construct(length);
+                this->setConstructed( isConstructed );
+            }
+
             /**
              * Constructor.
              *
@@ -198,6 +251,20 @@ namespace local
                 this->setConstructed( isConstructed );
             }
 
+            #if __cplusplus >= 201103L
+
+            /**
+             * Move constructor.
+             *
+             * @param obj - a source object which has no elements after the construction.
+             */
+            Buffer(Buffer<T,0,A>&& obj) : ParentSpec1(0), ParentSpec2(),
+                buf_       (NULL),
+                isDeleted_ (false){
+                move(obj);
+            }
+
+            #endif // C++11
 
             /**
              * Destructor.
@@ -206,7 +273,7 @@ namespace local
             {
                 if( isDeleted_ == true )
                 {
-                    A::free(buf_);
+                    ParentSpec2::free(buf_);
                 }
             }
 
@@ -240,6 +307,47 @@ namespace local
                 return *this;
             }
 
+            #if __cplusplus >= 201103L
+
+            /**
+             * Move assignment operator.
+             *
+             * Unlike the copy assignment, this buffer takes the length
+             * and the elements of the source buffer.
+             *
+             * @param obj - a source object which has no elements after the assignment.
+             * @return reference to this object.
+             */
+            Buffer& operator=(Buffer<T,0,A>&& obj)
+            {
+                move(obj);
+                return *this;
+            }
+
+            #endif // C++11
+
+            /**
+             * Returns an element of this buffer.
+             *
+             * NOTE: The operator hides the parent one for accessing the elements without calling virtual functions.
+             *
+             * @param index - an element index.
+             * @return an element.
+             */
+            T& operator[](const int32 index)
+            {
+                T* value;
+                if( not Construction::isConstructed(*this) || (index >= ParentSpec1::getLength()) || (buf_ == NULL) )
+                {
+                    value = &ParentSpec1::getIllegal();
+                }
+                else
+                {
+                    value = &buf_[index];
+                }
+                return *value;
+            }
+
         protected:
 
             /**
@@ -250,7 +358,7 @@ namespace local
             virtual T* getBuffer() const
             {
                 T* buf;
-                if( not ParentSpec1::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     buf = NULL;
                 }
@@ -272,11 +380,11 @@ namespace local
             bool construct(size_t const length)
             {
                 bool res;
-                if( ParentSpec1::isConstructed() )
+                if( Construction::isConstructed(*this) )
                 {
                     if(buf_ == NULL)
                     {
-                        void* const addr = A::allocate(length * (sizeof(T)));
+                        void* const addr = ParentSpec2::allocate(length * (sizeof(T)));
                         buf_ = reinterpret_cast<T*>( addr );
                     }
                     res = buf_ != NULL;
@@ -288,6 +396,33 @@ namespace local
                 return res;
             }
 
+            #if __cplusplus >= 201103L
+
+            /**
+             * Moves a passed buffer to this buffer.
+             *
+             * @param obj - a source object which has no elements after the call.
+             */
+            void move(Buffer<T,0,A>& obj)
+            {
+                if( Construction::isConstructed(*this) && &obj != this )
+                {
+                    if( isDeleted_ == true )
+                    {
+                        ParentSpec2::free(buf_);
+                    }
+                    // Take the allocation of the source elements for freeing them
+                    ParentSpec2::operator=(obj);
+                    buf_ = obj.buf_;
+                    isDeleted_ = obj.isDeleted_;
+                    ParentSpec1::move(obj);
+                    obj.buf_ = NULL;
+                    obj.isDeleted_ = false;
+                }
+            }
+
+            #endif // C++11
+
             /**
              * Copy constructor.
              *
@@ -0,0 +1,90 @@
+/**
+ * Value aligned to a cache line.
+ *
+ * The value is aligned and padded to the size of a cache line, so that values
+ * modified by different processor cores do not share one cache line. The size
+ * is given by the EOOS_CACHE_LINE macro, which is 64 bytes by default.
+ *
+ * NOTE: The alignment is given by the GCC attribute, and memory allocated
+ * for such values has to be aligned to the cache line by an allocator.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_CACHE_ALIGNED_HPP_
+#define LIBRARY_CACHE_ALIGNED_HPP_
+
+#include "Types.hpp"
+
+#ifndef EOOS_CACHE_LINE
+#define EOOS_CACHE_LINE 64
+#endif // EOOS_CACHE_LINE
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - type of the value.
+         * @param L - size in byte of a cache line, which is a power of two.
+         */
+        template <typename T, int32 L = EOOS_CACHE_LINE>
+        class CacheAligned
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            CacheAligned() :
+                value_ (){
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param value - an initial value.
+             */
+            explicit CacheAligned(const T& value) :
+                value_ (value){
+            }
+
+            /**
+             * Returns the value.
+             *
+             * @return reference to the value.
+             */
+            T& get()
+            {
+                return value_;
+            }
+
+            /**
+             * Returns the value.
+             *
+             * @return reference to the value.
+             */
+            const T& get() const
+            {
+                return value_;
+            }
+
+        private:
+
+            /**
+             * The value, which size is rounded up to its alignment.
+             */
+            #ifdef __GNUC__
+            T value_ __attribute__ ((aligned (L)));
+            #else
+            T value_;
+            #endif // __GNUC__
+
+        };
+    }
+}
+#endif // LIBRARY_CACHE_ALIGNED_HPP_
@@ -21,7 +21,7 @@ namespace local
          * @param A heap memory allocator class.
          */
         template <typename T, class A = Allocator>
-        class CircularList : public library::AbstractLinkedList<T,A>
+        class CircularList LIBRARY_FINAL : public library::AbstractLinkedList<T,A>
         {
             typedef library::AbstractLinkedList<T,A>  Parent;
             typedef library::LinkedNode<T,A>          Node;
@@ -44,6 +44,55 @@ namespace local
             {
             }
 
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this list nodes, which is a heap for the instance allocator.
+             */
+            explicit CircularList(const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * NOTE: A passed element must be copied to an internal data structure of
+             * this class by calling a copy constructor so that the element
+             * might be invalidated after the function called.
+             *
+             * @param illegal    - an illegal element.
+             * @param allocation - an allocation of this list nodes, which is a heap for the instance allocator.
+             */
+            CircularList(const T& illegal, const library::Allocation<A>& allocation) : Parent(illegal, allocation)
+            {
+            }
+
+            #if defined(EOOS_NO_STRICT_MISRA_RULES) && __cplusplus >= 201103L
+
+            /**
+             * Move constructor.
+             *
+             * @param obj - a source object which is empty after the construction.
+             */
+            CircularList(library::CircularList<T,A>&& obj) : Parent()
+            {
+                Parent::move(obj);
+            }
+
+            /**
+             * Move assignment operator.
+             *
+             * @param obj - a source object which is empty after the assignment.
+             * @return reference to this object.
+             */
+            library::CircularList<T,A>& operator=(library::CircularList<T,A>&& obj)
+            {
+                Parent::move(obj);
+                return *this;
+            }
+
+            #endif // EOOS_NO_STRICT_MISRA_RULES && C++11
+
             /**
              * Destructor.
              */
@@ -109,7 +158,7 @@ namespace local
                  * @param index position in this list.
                  * @param list  reference to self list.
                  */
-                Iterator(const int32 index, const List& list) :
+                Iterator(const int32 index, List& list) :
                     list_    (list),
                     count_   (list.getReferenceToCount()),
                     last_    (list.getReferenceToLast()),
@@ -200,14 +249,14 @@ namespace local
                  *
                  * @return reference to element.
                  */
-                virtual const T& getPrevious() const
+                virtual T& getPrevious() const
                 {
                     if( not hasPrevious())
                     {
                         return illegal_;
                     }
                     curs_ = curs_->getPrevious();
-                    rindex_ = curs_->index();
+                    rindex_ = curs_->getIndex();
                     return curs_->getElement();
                 }
 
@@ -244,7 +293,7 @@ namespace local
                  *
                  * @return reference to element.
                  */
-                virtual const T& getNext() const
+                virtual T& getNext() const
                 {
                     if( not hasNext() )
                     {
@@ -291,7 +340,7 @@ namespace local
                  *
                  * @return illegal element.
                  */
-                virtual const T& getIllegal() const
+                virtual T& getIllegal() const
                 {
                     return list_.getIllegal();
                 }
@@ -330,7 +379,7 @@ namespace local
                     {
                         return false;
                     }
-                    else if( not list_.isConstructed())
+                    else if( not Construction::isConstructed(list_) )
                     {
                         return false;
                     }
@@ -424,12 +473,12 @@ namespace local
                 /**
                  * Pointer to current node of this iterator.
                  */
-                Node* curs_;
+                mutable Node* curs_;
 
                 /**
                  * Index of element of list which can be removed by remove method.
                  */
-                int32 rindex_;
+                mutable int32 rindex_;
 
             };
         };
@@ -0,0 +1,78 @@
+/**
+ * Policy of testing objects construction.
+ *
+ * Methods of the library classes test if their objects have been constructed
+ * before doing anything. The debug policy, which is used by default, does
+ * the full test on each call. If the EOOS_RELEASE_CONSTRUCTION macro is defined,
+ * the release policy is used, and the tests are removed from the methods.
+ * For the release policy, an object has to be tested once by calling its
+ * isConstructed method after the object is created, and an object which has
+ * not been constructed must not be used.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_CONSTRUCTION_HPP_
+#define LIBRARY_CONSTRUCTION_HPP_
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Debug policy testing an object on each call.
+         */
+        class DebugConstruction
+        {
+
+        public:
+
+            /**
+             * Tests if an object has been constructed.
+             *
+             * The method of the object class is called directly,
+             * so that the call is not dispatched virtually.
+             *
+             * @param obj - an object to be tested.
+             * @return true if the object has been constructed successfully.
+             */
+            template <class O>
+            static bool isConstructed(const O& obj)
+            {
+                return obj.O::isConstructed();
+            }
+
+        };
+
+        /**
+         * Release policy relying on an object tested once after the object is created.
+         */
+        class ReleaseConstruction
+        {
+
+        public:
+
+            /**
+             * Tests if an object has been constructed.
+             *
+             * @param obj - an object to be tested.
+             * @return true.
+             */
+            template <class O>
+            static bool isConstructed(const O&)
+            {
+                return true;
+            }
+
+        };
+
+        #ifdef EOOS_RELEASE_CONSTRUCTION
+        typedef ReleaseConstruction Construction;
+        #else
+        typedef DebugConstruction Construction;
+        #endif // EOOS_RELEASE_CONSTRUCTION
+
+    }
+}
+#endif // LIBRARY_CONSTRUCTION_HPP_
@@ -0,0 +1,213 @@
+/**
+ * Counters of container operations.
+ *
+ * If the EOOS_COUNTERS macro is defined, lists and strings have counters of
+ * their costly operations, which are returned by their getCounters functions,
+ * and the counters of all the objects are summed up to the global counters.
+ * Otherwise, the objects have no counters, and the LIBRARY_COUNT hooks of the
+ * operations are removed.
+ *
+ * The global counters are not synchronized by default, so that they might
+ * lose increments of different threads. If the EOOS_COUNTERS_SHARDS macro is
+ * defined, the global counters are added atomically, and each of them has
+ * the macro number of shards of processor cores in separate cache lines.
+ * The EOOS_COUNTERS_SHARD macro is then an expression of the current shard
+ * index, for example the current core index. The shards are as wide as
+ * pointers, which are added atomically without locks on most targets.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_COUNTERS_HPP_
+#define LIBRARY_COUNTERS_HPP_
+
+#ifdef EOOS_COUNTERS_SHARDS
+#include "library.ShardedCounter.hpp"
+#else
+#include "Types.hpp"
+#endif // EOOS_COUNTERS_SHARDS
+
+#if defined(EOOS_COUNTERS_SHARDS) && !defined(EOOS_COUNTERS_SHARD)
+#define EOOS_COUNTERS_SHARD 0
+#endif // EOOS_COUNTERS_SHARD
+
+#ifdef EOOS_COUNTERS
+#define LIBRARY_COUNT(counters, counter, value) (counters).add( ::local::library::Counters::counter, static_cast< ::local::uint64 >(value) )
+#else
+#define LIBRARY_COUNT(counters, counter, value)
+#endif // EOOS_COUNTERS
+
+namespace local
+{
+    namespace library
+    {
+        class Counters
+        {
+
+        public:
+
+            /**
+             * Counted operations.
+             */
+            enum Counter
+            {
+                /**
+                 * Nodes of lists passed to find a node by an index or an element.
+                 */
+                NODES_TRAVERSED    = 0,
+
+                /**
+                 * Nodes of lists allocated.
+                 */
+                NODES_ALLOCATED    = 1,
+
+                /**
+                 * Nodes of lists which indexes are changed by inserting or removing a node.
+                 */
+                NODES_RENUMBERED   = 2,
+
+                /**
+                 * Buffers of string characters allocated.
+                 */
+                STRINGS_ALLOCATED  = 3,
+
+                /**
+                 * Characters of strings scanned to measure their lengths.
+                 */
+                CHARACTERS_SCANNED = 4,
+
+                /**
+                 * Number of the counters.
+                 */
+                COUNTERS           = 5
+            };
+
+            /**
+             * Constructor.
+             */
+            Counters()
+            {
+                reset();
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Counters()
+            {
+            }
+
+            /**
+             * Adds a value to a counter of this object and to the global counter.
+             *
+             * @param counter - a counter.
+             * @param value   - a value to add.
+             */
+            void add(Counter const counter, uint64 const value)
+            {
+                values_[counter] += value;
+                #ifdef EOOS_COUNTERS_SHARDS
+                getShards()[counter].add( EOOS_COUNTERS_SHARD, static_cast<uintptr>(value) );
+                #else
+                getValues()[counter] += value;
+                #endif // EOOS_COUNTERS_SHARDS
+            }
+
+            /**
+             * Returns a value of a counter.
+             *
+             * @param counter - a counter.
+             * @return the value.
+             */
+            uint64 get(Counter const counter) const
+            {
+                return values_[counter];
+            }
+
+            /**
+             * Resets all counters of this object.
+             */
+            void reset()
+            {
+                for(int32 i=0; i<COUNTERS; i++)
+                {
+                    values_[i] = 0;
+                }
+            }
+
+            /**
+             * Returns the global counters.
+             *
+             * @return a copy of the counters summing up counters of all objects.
+             */
+            static Counters getGlobal()
+            {
+                Counters res;
+                for(int32 i=0; i<COUNTERS; i++)
+                {
+                    #ifdef EOOS_COUNTERS_SHARDS
+                    res.values_[i] = static_cast<uint64>( getShards()[i].get() );
+                    #else
+                    res.values_[i] = getValues()[i];
+                    #endif // EOOS_COUNTERS_SHARDS
+                }
+                return res;
+            }
+
+            /**
+             * Resets the global counters.
+             */
+            static void resetGlobal()
+            {
+                for(int32 i=0; i<COUNTERS; i++)
+                {
+                    #ifdef EOOS_COUNTERS_SHARDS
+                    getShards()[i].reset();
+                    #else
+                    getValues()[i] = 0;
+                    #endif // EOOS_COUNTERS_SHARDS
+                }
+            }
+
+        private:
+
+            #ifdef EOOS_COUNTERS_SHARDS
+
+            typedef ShardedCounter<EOOS_COUNTERS_SHARDS, uintptr> Shard;
+
+            /**
+             * Returns the global counters.
+             *
+             * @return the first counter.
+             */
+            static Shard* getShards()
+            {
+                static Shard shards[COUNTERS];
+                return shards;
+            }
+
+            #else
+
+            /**
+             * Returns the global counters.
+             *
+             * @return the first counter.
+             */
+            static uint64* getValues()
+            {
+                static uint64 values[COUNTERS];
+                return values;
+            }
+
+            #endif // EOOS_COUNTERS_SHARDS
+
+            /**
+             * Values of the counters.
+             */
+            uint64 values_[COUNTERS];
+
+        };
+    }
+}
+#endif // LIBRARY_COUNTERS_HPP_
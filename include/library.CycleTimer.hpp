@@ -0,0 +1,120 @@
+/**
+ * Timer of the processor cycle counter.
+ *
+ * The timer reads the time stamp counter on x86 processors and the virtual
+ * counter on AArch64 processors. On other Unix targets, or if the
+ * EOOS_CYCLE_TIMER_MONOTONIC macro is defined, the monotonic clock is read,
+ * and a tick is one nanosecond. On other targets, the timer returns zero ticks.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_CYCLE_TIMER_HPP_
+#define LIBRARY_CYCLE_TIMER_HPP_
+
+#include "Types.hpp"
+
+#if defined(EOOS_CYCLE_TIMER_MONOTONIC) || !defined(__GNUC__) || !( defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) )
+#if defined(__unix__)
+#define LIBRARY_CYCLE_TIMER_MONOTONIC
+#include <time.h>
+#endif // __unix__
+#endif // EOOS_CYCLE_TIMER_MONOTONIC
+
+namespace local
+{
+    namespace library
+    {
+        class CycleTimer
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * The timer is started on constructing.
+             */
+            CycleTimer() :
+                start_ (getTicks()){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~CycleTimer()
+            {
+            }
+
+            /**
+             * Restarts this timer.
+             */
+            void restart()
+            {
+                start_ = getTicks();
+            }
+
+            /**
+             * Returns ticks elapsed since this timer has been started.
+             *
+             * @return number of ticks.
+             */
+            uint64 getElapsed() const
+            {
+                return getTicks() - start_;
+            }
+
+            /**
+             * Returns a value of the counter.
+             *
+             * @return number of ticks.
+             */
+            static uint64 getTicks()
+            {
+                uint64 res;
+                #if defined(LIBRARY_CYCLE_TIMER_MONOTONIC)
+                struct timespec ts;
+                static_cast<void>( ::clock_gettime(CLOCK_MONOTONIC, &ts) );
+                res = static_cast<uint64>(ts.tv_sec) * 1000000000ULL + static_cast<uint64>(ts.tv_nsec);
+                #elif defined(EOOS_CYCLE_TIMER_MONOTONIC) || !defined(__GNUC__)
+                res = 0;
+                #elif defined(__x86_64__) || defined(__i386__)
+                uint32 lo;
+                uint32 hi;
+                __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+                res = ( static_cast<uint64>(hi) << 32 ) | static_cast<uint64>(lo);
+                #elif defined(__aarch64__)
+                __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (res));
+                #else
+                res = 0;
+                #endif
+                return res;
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            CycleTimer(const CycleTimer& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            CycleTimer& operator=(const CycleTimer& obj);
+
+            /**
+             * Ticks of starting this timer.
+             */
+            uint64 start_;
+
+        };
+    }
+}
+#endif // LIBRARY_CYCLE_TIMER_HPP_
@@ -0,0 +1,364 @@
+/**
+ * Fallback memory allocator.
+ *
+ * The allocator serves memory from a chain of tiers. A pool region is tried
+ * first, a passed allocator is used when the pool is exhausted, and a reserved
+ * emergency region is used when the passed allocator fails, for example when
+ * its heap is fragmented. The regions are static and their memory is managed
+ * by library heaps created in them, so that memory of each tier is freed and
+ * reused, and memory is freed to the tier which address range it belongs to.
+ *
+ * The allocator is passed as a template argument of classes to make them
+ * degrade gracefully instead of failing, for example:
+ *
+ * typedef FallbackAllocator<0x1000, 0x10000> Fallback;
+ * LinkedList<int32,Fallback> list;
+ *
+ * A zero size of a region removes its tier from the chain. The allocator
+ * reports the tier which an allocation has been served by, and counts the
+ * allocations served by each tier. The regions are not guarded from concurrent
+ * access until a toggle of thread context switching is set.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_FALLBACK_ALLOCATOR_HPP_
+#define LIBRARY_FALLBACK_ALLOCATOR_HPP_
+
+#include "Allocator.hpp"
+#include "library.Heap.hpp"
+#include "library.Atomic.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param P - number of bytes of the pool region.
+         * @param E - number of bytes of the emergency region.
+         * @param A - heap memory allocator class used when the pool is exhausted.
+         */
+        template <int32 P = 4096, int32 E = 4096, class A = Allocator>
+        class FallbackAllocator
+        {
+
+        public:
+
+            /**
+             * Tiers of the chain.
+             */
+            enum Tier
+            {
+                /**
+                 * The pool region.
+                 */
+                POOL      = 0,
+
+                /**
+                 * The passed allocator.
+                 */
+                HEAP      = 1,
+
+                /**
+                 * The emergency region.
+                 */
+                EMERGENCY = 2,
+
+                /**
+                 * No tier, which counts failed allocations.
+                 */
+                FAILURE   = 3,
+
+                /**
+                 * Number of the tiers.
+                 */
+                TIERS     = 4
+            };
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size)
+            {
+                Tier tier;
+                return allocate(size, tier);
+            }
+
+            /**
+             * Allocates memory and reports a tier which has served the allocation.
+             *
+             * @param size - number of bytes to allocate.
+             * @param tier - a variable for the tier, which is FAILURE if no memory has been allocated.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size, Tier& tier)
+            {
+                void* res = allocateRegion(getPool(), size);
+                tier = POOL;
+                if(res == NULL)
+                {
+                    res = A::allocate(size);
+                    tier = HEAP;
+                }
+                if(res == NULL)
+                {
+                    res = allocateRegion(getEmergency(), size);
+                    tier = EMERGENCY;
+                }
+                if(res == NULL)
+                {
+                    tier = FAILURE;
+                }
+                static_cast<void>( counts_[tier].fetchAdd(1U, AtomicBase::RELAXED) );
+                return res;
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            static void free(void* const ptr)
+            {
+                switch( getTier(ptr) )
+                {
+                    case POOL:
+                    {
+                        freeRegion(getPool(), ptr);
+                        break;
+                    }
+                    case EMERGENCY:
+                    {
+                        freeRegion(getEmergency(), ptr);
+                        break;
+                    }
+                    case HEAP:
+                    {
+                        A::free(ptr);
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+            }
+
+            /**
+             * Returns a tier which an allocated memory belongs to.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             * @return the tier, or FAILURE for a null pointer.
+             */
+            static Tier getTier(const void* const ptr)
+            {
+                Tier res;
+                if(ptr == NULL)
+                {
+                    res = FAILURE;
+                }
+                else if( isOwner(pool_, sizeof(pool_), ptr) )
+                {
+                    res = POOL;
+                }
+                else if( isOwner(emergency_, sizeof(emergency_), ptr) )
+                {
+                    res = EMERGENCY;
+                }
+                else
+                {
+                    res = HEAP;
+                }
+                return res;
+            }
+
+            /**
+             * Returns a number of allocations served by a tier.
+             *
+             * @param tier - a tier, or FAILURE for a number of failed allocations.
+             * @return the number of allocations.
+             */
+            static uint64 getCount(Tier const tier)
+            {
+                return tier >= POOL && tier < TIERS ? static_cast<uint64>( counts_[tier].load(AtomicBase::RELAXED) ) : 0;
+            }
+
+            /**
+             * Resets the numbers of allocations of all tiers.
+             */
+            static void resetCounts()
+            {
+                for(int32 i=0; i<TIERS; i++)
+                {
+                    counts_[i].store(0U, AtomicBase::RELAXED);
+                }
+            }
+
+            /**
+             * Sets a toggle of thread context switching guarding the regions.
+             *
+             * @param toggle - a toggle, or NULL for not guarding the regions.
+             */
+            static void setToggle(api::Toggle* const toggle)
+            {
+                toggle_ = toggle;
+            }
+
+        private:
+
+            /**
+             * Number of 64-bit words of the pool region, which is not zero for declaring the region.
+             */
+            static const size_t POOL_LENGTH = ( static_cast<size_t>(P) + 7U ) / 8U + 1U;
+
+            /**
+             * Number of 64-bit words of the emergency region, which is not zero for declaring the region.
+             */
+            static const size_t EMERGENCY_LENGTH = ( static_cast<size_t>(E) + 7U ) / 8U + 1U;
+
+            /**
+             * Returns the heap of the pool region.
+             *
+             * @return the heap, or NULL if the region has no heap.
+             */
+            static Heap* getPool()
+            {
+                static Heap* const heap = P > 0 ? createHeap(pool_, sizeof(pool_)) : NULL;
+                return heap;
+            }
+
+            /**
+             * Returns the heap of the emergency region.
+             *
+             * @return the heap, or NULL if the region has no heap.
+             */
+            static Heap* getEmergency()
+            {
+                static Heap* const heap = E > 0 ? createHeap(emergency_, sizeof(emergency_)) : NULL;
+                return heap;
+            }
+
+            /**
+             * Creates a heap in a region.
+             *
+             * @param region - the region.
+             * @param size   - number of bytes of the region.
+             * @return the heap, or NULL if the heap has not been created.
+             */
+            static Heap* createHeap(uint64* const region, size_t const size)
+            {
+                Heap* res;
+                // The heap tests memory of its own data before checking the region size
+                if( size <= sizeof(Heap) )
+                {
+                    res = NULL;
+                }
+                else
+                {
+                    res = new ( reinterpret_cast<intptr>(region) ) Heap(static_cast<int64>(size), toggle_);
+                    if( res != NULL && not res->isConstructed() )
+                    {
+                        res = NULL;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Allocates memory in a heap of a region.
+             *
+             * @param heap - the heap, or NULL.
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocateRegion(Heap* const heap, size_t const size)
+            {
+                return heap != NULL ? heap->allocate(size, NULL) : NULL;
+            }
+
+            /**
+             * Frees memory in a heap of a region.
+             *
+             * @param heap - the heap, or NULL if the region has no heap.
+             * @param ptr  - address of allocated memory block.
+             */
+            static void freeRegion(Heap* const heap, void* const ptr)
+            {
+                if(heap != NULL)
+                {
+                    heap->free(ptr);
+                }
+            }
+
+            /**
+             * Tests if a memory belongs to a region.
+             *
+             * @param region - the region.
+             * @param size   - number of bytes of the region.
+             * @param ptr    - address of memory.
+             * @return true if the memory is in the region.
+             */
+            static bool isOwner(const uint64* const region, size_t const size, const void* const ptr)
+            {
+                uintptr const addr = reinterpret_cast<uintptr>(ptr);
+                uintptr const begin = reinterpret_cast<uintptr>(region);
+                return addr >= begin && addr < begin + size ? true : false;
+            }
+
+            /**
+             * The pool region.
+             */
+            static uint64 pool_[POOL_LENGTH];
+
+            /**
+             * The emergency region.
+             */
+            static uint64 emergency_[EMERGENCY_LENGTH];
+
+            /**
+             * Numbers of allocations served by the tiers.
+             *
+             * NOTE: The numbers have the machine word size as 64-bit atomics are not lock-free on all targets.
+             */
+            static Atomic<uintptr> counts_[TIERS];
+
+            /**
+             * Toggle of thread context switching guarding the regions.
+             */
+            static api::Toggle* toggle_;
+
+        };
+
+        /**
+         * The pool region.
+         */
+        template <int32 P, int32 E, class A>
+        uint64 FallbackAllocator<P,E,A>::pool_[FallbackAllocator<P,E,A>::POOL_LENGTH];
+
+        /**
+         * The emergency region.
+         */
+        template <int32 P, int32 E, class A>
+        uint64 FallbackAllocator<P,E,A>::emergency_[FallbackAllocator<P,E,A>::EMERGENCY_LENGTH];
+
+        /**
+         * Numbers of allocations served by the tiers.
+         */
+        template <int32 P, int32 E, class A>
+        Atomic<uintptr> FallbackAllocator<P,E,A>::counts_[FallbackAllocator<P,E,A>::TIERS];
+
+        /**
+         * Toggle of thread context switching guarding the regions.
+         */
+        template <int32 P, int32 E, class A>
+        api::Toggle* FallbackAllocator<P,E,A>::toggle_ = NULL;
+
+    }
+}
+#endif // LIBRARY_FALLBACK_ALLOCATOR_HPP_
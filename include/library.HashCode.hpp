@@ -0,0 +1,111 @@
+/**
+ * Class of compile-time hash codes of strings.
+ *
+ * The hash codes are equal to the hash codes calculated at run time by
+ * the Memory::getHashCode function and the String::getHashCode method.
+ * Thus, a string can be dispatched by a switch statement on its hash code,
+ * and each case label verifies the string by one comparison:
+ *
+ * switch( cmd.getHashCode() )
+ * {
+ *     case HashCode::Characters<'r','u','n'>::VALUE:
+ *     {
+ *         if(cmd == "run") ...
+ *     }
+ * }
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_HASH_CODE_HPP_
+#define LIBRARY_HASH_CODE_HPP_
+
+#include "library.Memory.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        class HashCode
+        {
+
+        public:
+
+            /**
+             * Hash code of a string passed as characters.
+             *
+             * The string is terminated by the first null character, and it
+             * is able to contain up to sixteen characters.
+             *
+             * @param C0-C15 - characters of a string.
+             * @param H      - a hash code of preceding characters, which has to be omitted.
+             */
+            template <
+                char C0,        char C1  = '\0', char C2  = '\0', char C3  = '\0',
+                char C4  = '\0', char C5  = '\0', char C6  = '\0', char C7  = '\0',
+                char C8  = '\0', char C9  = '\0', char C10 = '\0', char C11 = '\0',
+                char C12 = '\0', char C13 = '\0', char C14 = '\0', char C15 = '\0',
+                uint32 H = Memory::HASH_BASIS
+            >
+            struct Characters
+            {
+                static const uint32 VALUE = Characters<
+                    C1, C2,  C3,  C4,  C5,  C6,  C7,  C8,
+                    C9, C10, C11, C12, C13, C14, C15, '\0',
+                    (H ^ static_cast<ucell>(C0)) * Memory::HASH_PRIME
+                >::VALUE;
+            };
+
+            /**
+             * Hash code of a string terminated.
+             *
+             * @param C1-C15 - characters of a string following the null character.
+             * @param H      - a hash code of the string.
+             */
+            template <
+                char C1,  char C2,  char C3,  char C4,  char C5,
+                char C6,  char C7,  char C8,  char C9,  char C10,
+                char C11, char C12, char C13, char C14, char C15,
+                uint32 H
+            >
+            struct Characters<'\0', C1, C2, C3, C4, C5, C6, C7, C8, C9, C10, C11, C12, C13, C14, C15, H>
+            {
+                static const uint32 VALUE = H;
+            };
+
+            #if __cplusplus >= 201103L
+
+            /**
+             * Returns a hash code of a string.
+             *
+             * The function can be evaluated at compile time for string literals.
+             *
+             * @param str - a character string terminated by the null character.
+             * @return the hash code.
+             */
+            static constexpr uint32 get(const char* const str)
+            {
+                return get(str, Memory::HASH_BASIS);
+            }
+
+        private:
+
+            /**
+             * Returns a hash code of a string.
+             *
+             * @param str  - a character string terminated by the null character.
+             * @param hash - a hash code of preceding characters.
+             * @return the hash code.
+             */
+            static constexpr uint32 get(const char* const str, const uint32 hash)
+            {
+                return *str == '\0' ? hash : get(str + 1, (hash ^ static_cast<ucell>(*str)) * Memory::HASH_PRIME);
+            }
+
+            #endif // C++11
+
+        };
+    }
+}
+#endif // LIBRARY_HASH_CODE_HPP_
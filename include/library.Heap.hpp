@@ -11,6 +11,9 @@
 #define LIBRARY_HEAP_HPP_
 
 #include "api.SystemHeap.hpp"
+#include "library.Construction.hpp"
+#include "library.Profile.hpp"
+#include "library.Trace.hpp"
 
 namespace local
 {
@@ -90,7 +93,7 @@ namespace local
              */
             virtual void* allocate(const size_t size, void* ptr)
             {
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return NULL;
                 }
@@ -98,9 +101,11 @@ namespace local
                 {
                     return ptr;
                 }
+                LIBRARY_PROFILE(HEAP_ALLOCATE);
                 const bool is = disable();
                 ptr = getFirstBlock()->alloc(size);
                 enable(is);
+                LIBRARY_TRACE(HEAP_ALLOCATE, size, reinterpret_cast<uintptr>(ptr));
                 return ptr;
             }
 
@@ -115,13 +120,15 @@ namespace local
                 {
                     return;
                 }
-                if( not Self::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return;
                 }
+                LIBRARY_PROFILE(HEAP_FREE);
                 const bool is = disable();
                 heapBlock(ptr)->free();
                 enable(is);
+                LIBRARY_TRACE(HEAP_FREE, reinterpret_cast<uintptr>(ptr), 0);
             }
 
             /**
@@ -201,7 +208,7 @@ namespace local
             bool construct()
             {
                 // Crop a size to multiple of eight
-                if(sizeof(HeapBlock) + 16 > data_.size)
+                if(sizeof(HeapBlock) + 16 > static_cast<size_t>(data_.size))
                 {
                     return false;
                 }
@@ -517,7 +524,7 @@ namespace local
                             curr = curr->next_;
                             continue;
                         }
-                        if(curr->size_ < size)
+                        if(static_cast<size_t>(curr->size_) < size)
                         {
                             curr = curr->next_;
                             continue;
@@ -529,7 +536,7 @@ namespace local
                         return NULL;
                     }
                     // Has required memory size for data and a new heap block
-                    if(curr->size_ >= size + sizeof(HeapBlock))
+                    if(static_cast<size_t>(curr->size_) >= size + sizeof(HeapBlock))
                     {
                         HeapBlock* next = new ( curr->next(size) ) HeapBlock(heap_, curr->size_ - size);
                         if(next == NULL)
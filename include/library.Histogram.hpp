@@ -0,0 +1,344 @@
+/**
+ * Histogram of values recorded with a relative precision.
+ *
+ * The histogram has a fixed number of buckets and does not allocate memory.
+ * Each range of values from a power of two to the next power of two is split
+ * into 2^P buckets of equal width, so that a recorded value is counted with
+ * the relative error not greater than 2^-P, and values of the whole uint64 range
+ * are recorded. The histograms of different threads or periods are merged
+ * into one, and a histogram is copied for taking its snapshot.
+ *
+ * NOTE: The functions are not synchronized, so that a histogram has to be
+ * recorded by one thread at a time.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_HISTOGRAM_HPP_
+#define LIBRARY_HISTOGRAM_HPP_
+
+#include "Types.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param P - number of bits of precision from 1 to 8.
+         */
+        template <int32 P = 3>
+        class Histogram
+        {
+
+        public:
+
+            /**
+             * Number of buckets.
+             */
+            static const int32 BUCKETS = ( 65 - P ) << P;
+
+            /**
+             * Constructor.
+             */
+            Histogram() :
+                count_ (0),
+                min_   (0),
+                max_   (0),
+                sum_   (0){
+                reset();
+            }
+
+            /**
+             * Destructor.
+             */
+           ~Histogram()
+            {
+            }
+
+            /**
+             * Records a value.
+             *
+             * @param value - a recorded value.
+             */
+            void record(uint64 const value)
+            {
+                record(value, 1);
+            }
+
+            /**
+             * Records a value a number of times.
+             *
+             * @param value - a recorded value.
+             * @param count - a number of the value occurrences.
+             */
+            void record(uint64 const value, uint64 const count)
+            {
+                if(count != 0)
+                {
+                    counts_[ getIndex(value) ] += count;
+                    add(value, value, count, value * count);
+                }
+            }
+
+            /**
+             * Adds values recorded by a passed histogram to this histogram.
+             *
+             * @param obj - a source histogram.
+             */
+            void merge(const Histogram<P>& obj)
+            {
+                if(obj.count_ != 0)
+                {
+                    for(int32 i=0; i<BUCKETS; i++)
+                    {
+                        counts_[i] += obj.counts_[i];
+                    }
+                    add(obj.min_, obj.max_, obj.count_, obj.sum_);
+                }
+            }
+
+            /**
+             * Removes all recorded values.
+             */
+            void reset()
+            {
+                for(int32 i=0; i<BUCKETS; i++)
+                {
+                    counts_[i] = 0;
+                }
+                count_ = 0;
+                min_ = 0;
+                max_ = 0;
+                sum_ = 0;
+            }
+
+            /**
+             * Returns a number of recorded values.
+             *
+             * @return number of values.
+             */
+            uint64 getCount() const
+            {
+                return count_;
+            }
+
+            /**
+             * Returns the minimum recorded value.
+             *
+             * @return the value, or zero if no values are recorded.
+             */
+            uint64 getMin() const
+            {
+                return min_;
+            }
+
+            /**
+             * Returns the maximum recorded value.
+             *
+             * @return the value, or zero if no values are recorded.
+             */
+            uint64 getMax() const
+            {
+                return max_;
+            }
+
+            /**
+             * Returns the mean of recorded values.
+             *
+             * @return the value, or zero if no values are recorded.
+             */
+            uint64 getMean() const
+            {
+                return count_ != 0 ? sum_ / count_ : 0;
+            }
+
+            /**
+             * Returns a value which a percentage of recorded values is not greater than.
+             *
+             * The value is the highest value of a bucket, which is equivalent
+             * to the values counted in the bucket, and is not greater than
+             * the maximum recorded value.
+             *
+             * @param percentile - a percentage of values from 0 to 100.
+             * @return the value, or zero if no values are recorded.
+             */
+            uint64 getValueAtPercentile(double const percentile) const
+            {
+                uint64 res;
+                if(count_ == 0)
+                {
+                    res = 0;
+                }
+                else if( not (percentile > 0.0) )
+                {
+                    res = min_;
+                }
+                else if(percentile >= 100.0)
+                {
+                    res = max_;
+                }
+                else
+                {
+                    // Rank of the value rounded up
+                    double const exact = percentile * static_cast<double>(count_) / 100.0;
+                    uint64 rank = static_cast<uint64>(exact);
+                    if( static_cast<double>(rank) < exact )
+                    {
+                        rank++;
+                    }
+                    res = max_;
+                    uint64 total = 0;
+                    for(int32 i=0; i<BUCKETS; i++)
+                    {
+                        total += counts_[i];
+                        if(total >= rank)
+                        {
+                            uint64 const value = getHighest(i);
+                            res = value < max_ ? value : max_;
+                            break;
+                        }
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Returns a number of values counted in a bucket.
+             *
+             * @param index - an index of the bucket.
+             * @return number of values, or zero if the index is out of the buckets.
+             */
+            uint64 getCount(int32 const index) const
+            {
+                return 0 <= index && index < BUCKETS ? counts_[index] : 0;
+            }
+
+            /**
+             * Returns the lowest value counted in a bucket.
+             *
+             * @param index - an index of the bucket.
+             * @return the value.
+             */
+            static uint64 getLowest(int32 const index)
+            {
+                int32 const range = index >> P;
+                uint64 const sub = static_cast<uint64>(index & MASK);
+                return range == 0 ? sub : ( ( static_cast<uint64>(1) << P ) + sub ) << (range - 1);
+            }
+
+            /**
+             * Returns the highest value counted in a bucket.
+             *
+             * @param index - an index of the bucket.
+             * @return the value.
+             */
+            static uint64 getHighest(int32 const index)
+            {
+                int32 const range = index >> P;
+                return range == 0 ? getLowest(index) : getLowest(index) + ( ( static_cast<uint64>(1) << (range - 1) ) - 1 );
+            }
+
+            /**
+             * Returns an index of a bucket counting a value.
+             *
+             * @param value - a value.
+             * @return the index of the bucket.
+             */
+            static int32 getIndex(uint64 const value)
+            {
+                int32 res;
+                if( value < ( static_cast<uint64>(1) << P ) )
+                {
+                    res = static_cast<int32>(value);
+                }
+                else
+                {
+                    // The most significant bit of the value is not less than P
+                    int32 const msb = getMostSignificantBit(value);
+                    int32 const sub = static_cast<int32>( value >> (msb - P) ) & MASK;
+                    res = ( (msb - P + 1) << P ) + sub;
+                }
+                return res;
+            }
+
+        private:
+
+            /**
+             * Mask of an index of a bucket in its range.
+             */
+            static const int32 MASK = ( 1 << P ) - 1;
+
+            /**
+             * Adds statistics of values.
+             *
+             * @param min   - the minimum value.
+             * @param max   - the maximum value.
+             * @param count - a number of the values.
+             * @param sum   - a sum of the values.
+             */
+            void add(uint64 const min, uint64 const max, uint64 const count, uint64 const sum)
+            {
+                if(count_ == 0 || min < min_)
+                {
+                    min_ = min;
+                }
+                if(max > max_)
+                {
+                    max_ = max;
+                }
+                count_ += count;
+                sum_ += sum;
+            }
+
+            /**
+             * Returns the most significant bit of a value.
+             *
+             * @param value - a value which is not zero.
+             * @return the bit number.
+             */
+            static int32 getMostSignificantBit(uint64 value)
+            {
+                int32 res = 0;
+                for(int32 shift=32; shift>0; shift>>=1)
+                {
+                    if( value >= ( static_cast<uint64>(1) << shift ) )
+                    {
+                        value >>= shift;
+                        res += shift;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Numbers of values counted in the buckets.
+             */
+            uint64 counts_[BUCKETS];
+
+            /**
+             * Number of recorded values.
+             */
+            uint64 count_;
+
+            /**
+             * The minimum recorded value.
+             */
+            uint64 min_;
+
+            /**
+             * The maximum recorded value.
+             */
+            uint64 max_;
+
+            /**
+             * Sum of recorded values.
+             */
+            uint64 sum_;
+
+        };
+    }
+}
+#endif // LIBRARY_HISTOGRAM_HPP_
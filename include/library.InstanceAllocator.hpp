@@ -0,0 +1,63 @@
+/**
+ * Allocator of containers having own heaps.
+ *
+ * Containers which template argument is this class refer to a heap passed to
+ * their constructors, and memory of their elements is allocated in the heap,
+ * for example:
+ *
+ * typedef InstanceAllocator<> Instance;
+ * LinkedList<int32,Instance> list(heap);
+ *
+ * The static functions of the class, which are called for allocating objects by
+ * the new operator and for containers constructed without a heap, allocate memory
+ * by a passed allocator.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_INSTANCE_ALLOCATOR_HPP_
+#define LIBRARY_INSTANCE_ALLOCATOR_HPP_
+
+#include "Allocator.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param A - heap memory allocator class used when no heap is passed.
+         */
+        template <class A = Allocator>
+        class InstanceAllocator
+        {
+
+        public:
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size)
+            {
+                return A::allocate(size);
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            static void free(void* const ptr)
+            {
+                A::free(ptr);
+            }
+
+        };
+    }
+}
+#endif // LIBRARY_INSTANCE_ALLOCATOR_HPP_
@@ -21,7 +21,7 @@ namespace local
          * @param A heap memory allocator class.
          */
         template <typename T, class A = Allocator>
-        class LinkedList : public library::AbstractLinkedList<T,A>
+        class LinkedList LIBRARY_FINAL : public library::AbstractLinkedList<T,A>
         {
             typedef library::AbstractLinkedList<T,A>  Parent;
             typedef library::LinkedNode<T,A>          Node;
@@ -48,6 +48,55 @@ namespace local
             {
             }
 
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this list nodes, which is a heap for the instance allocator.
+             */
+            explicit LinkedList(const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * NOTE: A passed element must be copied to an internal data structure of
+             * this class by calling a copy constructor so that the element
+             * might be invalidated after the function called.
+             *
+             * @param illegal    - an illegal element.
+             * @param allocation - an allocation of this list nodes, which is a heap for the instance allocator.
+             */
+            LinkedList(const T& illegal, const library::Allocation<A>& allocation) : Parent(illegal, allocation)
+            {
+            }
+
+            #if defined(EOOS_NO_STRICT_MISRA_RULES) && __cplusplus >= 201103L
+
+            /**
+             * Move constructor.
+             *
+             * @param obj - a source object which is empty after the construction.
+             */
+            LinkedList(library::LinkedList<T,A>&& obj) : Parent()
+            {
+                Parent::move(obj);
+            }
+
+            /**
+             * Move assignment operator.
+             *
+             * @param obj - a source object which is empty after the assignment.
+             * @return reference to this object.
+             */
+            library::LinkedList<T,A>& operator=(library::LinkedList<T,A>&& obj)
+            {
+                Parent::move(obj);
+                return *this;
+            }
+
+            #endif // EOOS_NO_STRICT_MISRA_RULES && C++11
+
             /**
              * Destructor.
              */
@@ -63,7 +112,7 @@ namespace local
              */
             virtual api::ListIterator<T>* getListIterator(const int32 index)
             {
-                if( not Parent::isConstructed() )
+                if( not Construction::isConstructed(*this) )
                 {
                     return NULL;
                 }
@@ -334,11 +383,11 @@ namespace local
                  */
                 bool construct(const int32 index)
                 {
-                    if( not Self::isConstructed() )
+                    if( not Construction::isConstructed(*this) )
                     {
                         return false;
                     }
-                    if( not list_.isConstructed() )
+                    if( not Construction::isConstructed(list_) )
                     {
                         return false;
                     }
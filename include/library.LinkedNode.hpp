@@ -21,7 +21,7 @@ namespace local
          * @param A heap memory allocator class.
          */
         template <typename T, class A = Allocator>
-        class LinkedNode : public library::Object<A>
+        class LinkedNode LIBRARY_FINAL : public library::Object<A>
         {
             typedef library::LinkedNode<T,A> Self;
             typedef library::Object<A>       Parent;
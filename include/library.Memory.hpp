@@ -158,6 +158,369 @@ namespace local
                 return res;
             }
 
+            /**
+             * Locates a character in a block of memory.
+             *
+             * The block is scanned by words of four characters, and each word
+             * is tested for containing the character by a few of arithmetic operations.
+             *
+             * @param src a block of memory to be scanned.
+             * @param val a value to be located.
+             * @param len a number of bytes to be scanned.
+             * @return a pointer to the first located character, or NULL if the value has not been found.
+             */
+            static const void* memchr(const void* const src, const cell val, size_t len)
+            {
+                if(src == NULL)
+                {
+                    return NULL;
+                }
+                const cell* sp = static_cast<const cell*>(src);
+                // Scan the unaligned head byte by byte
+                while( len != 0 && (reinterpret_cast<uintptr>(sp) & WORD_MASK) != 0 )
+                {
+                    if(*sp == val)
+                    {
+                        return sp;
+                    }
+                    sp++;
+                    len--;
+                }
+                // Scan the aligned body word by word
+                const Word pattern = static_cast<Word>( static_cast<ucell>(val) ) * WORD_ONES;
+                const Word* wp = reinterpret_cast<const Word*>(sp);
+                while(len >= sizeof(Word))
+                {
+                    if( hasZero(*wp ^ pattern) )
+                    {
+                        break;
+                    }
+                    wp++;
+                    len -= sizeof(Word);
+                }
+                // Locate the character in the found word or in the tail
+                sp = reinterpret_cast<const cell*>(wp);
+                while(len-- != 0)
+                {
+                    if(*sp == val)
+                    {
+                        return sp;
+                    }
+                    sp++;
+                }
+                return NULL;
+            }
+
+            /**
+             * Returns a number of leading 7-bit characters of a block of memory.
+             *
+             * The block is scanned by words of four characters, and each word
+             * is tested for having high bits set by one operation.
+             *
+             * @param src a block of memory to be scanned.
+             * @param len a number of bytes of the block.
+             * @return a number of bytes preceding the first byte which high bit is set.
+             */
+            static size_t getAsciiLength(const void* const src, const size_t len)
+            {
+                if(src == NULL)
+                {
+                    return 0;
+                }
+                const cell* const begin = static_cast<const cell*>(src);
+                const cell* sp = begin;
+                size_t rest = len;
+                // Scan the unaligned head byte by byte
+                while( rest != 0 && (reinterpret_cast<uintptr>(sp) & WORD_MASK) != 0 )
+                {
+                    if( isHigh(*sp) )
+                    {
+                        return static_cast<size_t>(sp - begin);
+                    }
+                    sp++;
+                    rest--;
+                }
+                // Scan the aligned body word by word
+                const Word* wp = reinterpret_cast<const Word*>(sp);
+                while( rest >= sizeof(Word) && (*wp & WORD_HIGHS) == 0 )
+                {
+                    wp++;
+                    rest -= sizeof(Word);
+                }
+                // Locate the character in the found word or in the tail
+                sp = reinterpret_cast<const cell*>(wp);
+                while( rest != 0 && not isHigh(*sp) )
+                {
+                    sp++;
+                    rest--;
+                }
+                return static_cast<size_t>(sp - begin);
+            }
+
+            /**
+             * Converts characters of a string to lower case.
+             *
+             * Only Latin letters of the 7-bit character set are converted. The string
+             * is converted by words of four characters, and all letters of a word
+             * are converted by a few of arithmetic operations.
+             *
+             * @param str a character string to be converted.
+             * @param len a number of characters of the string.
+             */
+            static void toLowerCase(char* const str, const size_t len)
+            {
+                convertCase(str, len, true);
+            }
+
+            /**
+             * Converts characters of a string to upper case.
+             *
+             * Only Latin letters of the 7-bit character set are converted. The string
+             * is converted by words of four characters, and all letters of a word
+             * are converted by a few of arithmetic operations.
+             *
+             * @param str a character string to be converted.
+             * @param len a number of characters of the string.
+             */
+            static void toUpperCase(char* const str, const size_t len)
+            {
+                convertCase(str, len, false);
+            }
+
+            /**
+             * Compares two strings ignoring case of characters.
+             *
+             * Only Latin letters of the 7-bit character set are compared ignoring case.
+             * If the strings are aligned equally, they are compared by words of four characters.
+             *
+             * @param str1 character string to be compared.
+             * @param str2 character string to be compared.
+             * @param len  a number of characters to be compared.
+             * @return the value 0 if the string 1 is equal to the string 2;
+             *         a value less than 0 if the string 1 is less than the string 2;
+             *         a value greater than 0 if the string 1 is greater than the string 2,
+             *         or the minimum possible value if an error has been occurred.
+             */
+            static int32 compareIgnoreCase(const char* str1, const char* str2, size_t len)
+            {
+                if(str1 == NULL || str2 == NULL)
+                {
+                    return 0x80000000;
+                }
+                const uintptr addr1 = reinterpret_cast<uintptr>(str1);
+                const uintptr addr2 = reinterpret_cast<uintptr>(str2);
+                if( (addr1 & WORD_MASK) == (addr2 & WORD_MASK) )
+                {
+                    // Compare the unaligned head byte by byte
+                    while( len != 0 && (reinterpret_cast<uintptr>(str1) & WORD_MASK) != 0 )
+                    {
+                        const int32 res = toLowerCase(*str1++) - toLowerCase(*str2++);
+                        if(res != 0)
+                        {
+                            return res;
+                        }
+                        len--;
+                    }
+                    // Skip the aligned equal words
+                    const Word* wp1 = reinterpret_cast<const Word*>(str1);
+                    const Word* wp2 = reinterpret_cast<const Word*>(str2);
+                    while( len >= sizeof(Word) && toLowerCase(*wp1) == toLowerCase(*wp2) )
+                    {
+                        wp1++;
+                        wp2++;
+                        len -= sizeof(Word);
+                    }
+                    str1 = reinterpret_cast<const char*>(wp1);
+                    str2 = reinterpret_cast<const char*>(wp2);
+                }
+                // Compare the rest byte by byte
+                while(len-- != 0)
+                {
+                    const int32 res = toLowerCase(*str1++) - toLowerCase(*str2++);
+                    if(res != 0)
+                    {
+                        return res;
+                    }
+                }
+                return 0;
+            }
+
+            /**
+             * Returns a hash code of a string.
+             *
+             * The hash code is the 32-bit FNV-1a hash of the string characters.
+             *
+             * @param str a character string to be hashed.
+             * @param len a number of characters of the string.
+             * @return the hash code.
+             */
+            static uint32 getHashCode(const char* const str, const size_t len)
+            {
+                uint32 hash = HASH_BASIS;
+                if(str != NULL)
+                {
+                    for(size_t i=0; i<len; i++)
+                    {
+                        hash = (hash ^ static_cast<ucell>(str[i])) * HASH_PRIME;
+                    }
+                }
+                return hash;
+            }
+
+            /**
+             * Returns a hash code of a string ignoring case of characters.
+             *
+             * The hash code is the hash code of the string converted to lower case.
+             *
+             * @param str a character string to be hashed.
+             * @param len a number of characters of the string.
+             * @return the hash code.
+             */
+            static uint32 getHashCodeIgnoreCase(const char* const str, const size_t len)
+            {
+                uint32 hash = HASH_BASIS;
+                if(str != NULL)
+                {
+                    for(size_t i=0; i<len; i++)
+                    {
+                        hash = (hash ^ static_cast<uint32>( toLowerCase(str[i]) )) * HASH_PRIME;
+                    }
+                }
+                return hash;
+            }
+
+            /**
+             * Offset basis of the 32-bit FNV-1a hash.
+             */
+            static const uint32 HASH_BASIS = 0x811C9DC5U;
+
+            /**
+             * Prime of the 32-bit FNV-1a hash.
+             */
+            static const uint32 HASH_PRIME = 0x01000193U;
+
+            /**
+             * Returns the index of the first occurrence of a character in a character array.
+             *
+             * @param str a character array to be scanned.
+             * @param len a number of characters of the array.
+             * @param ch  a character to be located.
+             * @return the index of the character, or -1 if the array does not contain the character.
+             */
+            template <typename T>
+            static int32 getIndexOf(const T* const str, const int32 len, const T& ch)
+            {
+                if(str == NULL)
+                {
+                    return -1;
+                }
+                for(int32 i=0; i<len; i++)
+                {
+                    if(str[i] == ch)
+                    {
+                        return i;
+                    }
+                }
+                return -1;
+            }
+
+            /**
+             * Returns the index of the first occurrence of a character in a character string.
+             *
+             * @param str a character string to be scanned.
+             * @param len a number of characters of the string.
+             * @param ch  a character to be located.
+             * @return the index of the character, or -1 if the string does not contain the character.
+             */
+            static int32 getIndexOf(const char* const str, const int32 len, const char ch)
+            {
+                if(str == NULL || len <= 0)
+                {
+                    return -1;
+                }
+                const void* const ptr = memchr(str, static_cast<cell>(ch), static_cast<size_t>(len));
+                if(ptr == NULL)
+                {
+                    return -1;
+                }
+                return static_cast<int32>( static_cast<const char*>(ptr) - str );
+            }
+
+            /**
+             * Returns the index of the first occurrence of a substring in a character array.
+             *
+             * @param str    a character array to be scanned.
+             * @param len    a number of characters of the array.
+             * @param sub    a substring to be located.
+             * @param sublen a number of characters of the substring.
+             * @return the index of the substring, or -1 if the array does not contain the substring.
+             */
+            template <typename T>
+            static int32 getIndexOf(const T* const str, const int32 len, const T* const sub, const int32 sublen)
+            {
+                if(str == NULL || sub == NULL || sublen > len)
+                {
+                    return -1;
+                }
+                const int32 max = len - sublen;
+                for(int32 i=0; i<=max; i++)
+                {
+                    int32 j = 0;
+                    while(j < sublen && str[i + j] == sub[j])
+                    {
+                        j++;
+                    }
+                    if(j == sublen)
+                    {
+                        return i;
+                    }
+                }
+                return -1;
+            }
+
+            /**
+             * Returns the index of the first occurrence of a substring in a character string.
+             *
+             * The first character of the substring is located by the word scanning,
+             * and the last character is tested before comparing the whole substring.
+             *
+             * @param str    a character string to be scanned.
+             * @param len    a number of characters of the string.
+             * @param sub    a substring to be located.
+             * @param sublen a number of characters of the substring.
+             * @return the index of the substring, or -1 if the string does not contain the substring.
+             */
+            static int32 getIndexOf(const char* const str, const int32 len, const char* const sub, const int32 sublen)
+            {
+                if(str == NULL || sub == NULL || sublen > len)
+                {
+                    return -1;
+                }
+                if(sublen <= 0)
+                {
+                    return 0;
+                }
+                const char first = sub[0];
+                const char last = sub[sublen - 1];
+                const int32 max = len - sublen;
+                int32 i = 0;
+                while(i <= max)
+                {
+                    const int32 index = getIndexOf(&str[i], max - i + 1, first);
+                    if(index < 0)
+                    {
+                        break;
+                    }
+                    i += index;
+                    if(str[i + sublen - 1] == last && isEqual(&str[i + 1], &sub[1], sublen - 2))
+                    {
+                        return i;
+                    }
+                    i++;
+                }
+                return -1;
+            }
+
             /**
              * Converts an integer number to a string.
              *
@@ -256,6 +619,178 @@ namespace local
                 return res;
             }
 
+            /**
+             * Returns a number of characters of an integer number converted to a string.
+             *
+             * The number is converted by the rules of the itoa function, and its digits
+             * are padded with leading zeros up to a passed width, which does not include a minus sign.
+             *
+             * @param val   a value that would be converted to a string.
+             * @param base  a numerical base used to represent a value as a string.
+             * @param width a minimum number of digits.
+             * @return the number of characters, or -1 if the value cannot be converted.
+             */
+            template <typename T>
+            static int32 getIntegerLength(const T val, const int32 base = 10, const int32 width = 0)
+            {
+                switch(base)
+                {
+                    case  2:
+                    case  8:
+                    case 10:
+                    case 16: break;
+                    default: return -1;
+                }
+                const bool isNegative = not isPositive(val) ? true : false;
+                if(isNegative && base != 10)
+                {
+                    return -1;
+                }
+                // The value is not negated, so the minimum value of a signed type is converted too
+                T module = val;
+                int32 count = 0;
+                do
+                {
+                    module = module / base;
+                    count++;
+                }
+                while(module != 0);
+                if(count < width)
+                {
+                    count = width;
+                }
+                return isNegative ? count + 1 : count;
+            }
+
+            /**
+             * Converts an integer number to a string of a known length.
+             *
+             * The function writes exactly a passed number of characters, which has to be
+             * got by the getIntegerLength function for the value and the base, and
+             * does not terminate the string.
+             *
+             * @param val  a value that would be converted to a string.
+             * @param str  a character string for a result of the conversion.
+             * @param len  a number of characters of the result.
+             * @param base a numerical base used to represent a value as a string.
+             */
+            template <typename T>
+            static void formatInteger(const T val, char* const str, const int32 len, const int32 base = 10)
+            {
+                const bool isNegative = not isPositive(val) ? true : false;
+                const int32 first = isNegative ? 1 : 0;
+                T module = val;
+                int32 index = len - 1;
+                // Write digits from the last one
+                do
+                {
+                    int32 digit = static_cast<int32>(module % base);
+                    if(digit < 0)
+                    {
+                        digit = 0 - digit;
+                    }
+                    str[index--] = static_cast<char>( digit > 9 ? digit - 10 + 'a' : digit + '0' );
+                    module = module / base;
+                }
+                while(module != 0 && index >= first);
+                // Pad the digits with leading zeros
+                while(index >= first)
+                {
+                    str[index--] = '0';
+                }
+                if(isNegative)
+                {
+                    str[0] = '-';
+                }
+            }
+
+            /**
+             * Returns a number of characters of a floating point number converted to a string.
+             *
+             * The number is represented in fixed-point notation with a passed number of
+             * fractional digits, and it is rounded half away from zero. Not-a-number and
+             * infinite values are represented as "nan", "inf" and "-inf" strings.
+             *
+             * @param val       a value that would be converted to a string.
+             * @param precision a number of fractional digits from 0 to 9.
+             * @return the number of characters, or -1 if the precision is wrong or
+             *         the integral part of the value exceeds 64-bit unsigned integer.
+             */
+            static int32 getFloatLength(const double val, const int32 precision = 6)
+            {
+                bool isNegative;
+                uint64 integral;
+                uint64 fraction;
+                int32 res;
+                if(precision < 0 || precision > MAX_FLOAT_PRECISION)
+                {
+                    res = -1;
+                }
+                else if( not isFinite(val) )
+                {
+                    res = val < 0.0 ? 4 : 3;
+                }
+                else if( not split(val, precision, isNegative, integral, fraction) )
+                {
+                    res = -1;
+                }
+                else
+                {
+                    res = getIntegerLength<uint64>(integral);
+                    if(isNegative)
+                    {
+                        res += 1;
+                    }
+                    if(precision != 0)
+                    {
+                        res += precision + 1;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Converts a floating point number to a string of a known length.
+             *
+             * The function writes exactly a passed number of characters, which has to be
+             * got by the getFloatLength function for the value and the precision, and
+             * does not terminate the string.
+             *
+             * @param val       a value that would be converted to a string.
+             * @param str       a character string for a result of the conversion.
+             * @param len       a number of characters of the result.
+             * @param precision a number of fractional digits from 0 to 9.
+             */
+            static void formatFloat(const double val, char* str, const int32 len, const int32 precision = 6)
+            {
+                bool isNegative;
+                uint64 integral;
+                uint64 fraction;
+                if( not isFinite(val) )
+                {
+                    const char* const word = val != val ? "nan" : val < 0.0 ? "-inf" : "inf";
+                    for(int32 i=0; i<len; i++)
+                    {
+                        str[i] = word[i];
+                    }
+                }
+                else if( split(val, precision, isNegative, integral, fraction) )
+                {
+                    const int32 fractionLength = precision != 0 ? precision + 1 : 0;
+                    if(isNegative)
+                    {
+                        *str++ = '-';
+                    }
+                    char* const point = str + len - fractionLength - (isNegative ? 1 : 0);
+                    formatInteger<uint64>(integral, str, static_cast<int32>(point - str));
+                    if(precision != 0)
+                    {
+                        *point = '.';
+                        formatInteger<uint64>(fraction, point + 1, precision);
+                    }
+                }
+            }
+
             /**
              * Converts a string to an integer number.
              *
@@ -325,6 +860,239 @@ namespace local
 
         private:
 
+            /**
+             * Word type for scanning a block of memory.
+             *
+             * The type is allowed to alias any other type
+             * as the words are read from character arrays.
+             */
+            #ifdef __GNUC__
+            typedef uint32 __attribute__((__may_alias__)) Word;
+            #else
+            typedef uint32 Word;
+            #endif
+
+            /**
+             * Mask of word address unaligned bits.
+             */
+            static const uintptr WORD_MASK = sizeof(Word) - 1;
+
+            /**
+             * Word having one in each byte.
+             */
+            static const Word WORD_ONES = 0x01010101U;
+
+            /**
+             * Word having high bit in each byte.
+             */
+            static const Word WORD_HIGHS = 0x80808080U;
+
+            /**
+             * Tests if a word has a zero byte.
+             *
+             * @param word a testing word.
+             * @return true if one of the word bytes is zero.
+             */
+            static bool hasZero(const Word word)
+            {
+                return ( (word - WORD_ONES) & ~word & WORD_HIGHS ) != 0 ? true : false;
+            }
+
+            /**
+             * Converts Latin letters of a word to lower case.
+             *
+             * Each byte is tested to be 7-bit, not less than 'A', and
+             * not greater than 'Z' by adding constants to its low seven bits,
+             * which never carry to the next byte.
+             *
+             * @param word a word to be converted.
+             * @return the converted word.
+             */
+            static Word toLowerCase(const Word word)
+            {
+                const Word low = word & ~WORD_HIGHS;
+                const Word isAbove = low + (0x7FU - 'Z') * WORD_ONES;
+                const Word isLetter = low + (0x80U - 'A') * WORD_ONES;
+                const Word mask = ~word & (isLetter ^ isAbove) & WORD_HIGHS;
+                return word | (mask >> 2);
+            }
+
+            /**
+             * Converts Latin letters of a word to upper case.
+             *
+             * @param word a word to be converted.
+             * @return the converted word.
+             */
+            static Word toUpperCase(const Word word)
+            {
+                const Word low = word & ~WORD_HIGHS;
+                const Word isAbove = low + (0x7FU - 'z') * WORD_ONES;
+                const Word isLetter = low + (0x80U - 'a') * WORD_ONES;
+                const Word mask = ~word & (isLetter ^ isAbove) & WORD_HIGHS;
+                return word & ~(mask >> 2);
+            }
+
+            /**
+             * Converts a Latin letter to lower case.
+             *
+             * @param ch a character to be converted.
+             * @return the converted character code.
+             */
+            static int32 toLowerCase(const char ch)
+            {
+                const int32 code = static_cast<ucell>(ch);
+                return code >= 'A' && code <= 'Z' ? code + ('a' - 'A') : code;
+            }
+
+            /**
+             * Converts Latin letters of a string case.
+             *
+             * @param str   a character string to be converted.
+             * @param len   a number of characters of the string.
+             * @param lower true for converting to lower case, and false for upper case.
+             */
+            static void convertCase(char* str, size_t len, const bool lower)
+            {
+                if(str == NULL)
+                {
+                    return;
+                }
+                // Convert the unaligned head byte by byte
+                while( len != 0 && (reinterpret_cast<uintptr>(str) & WORD_MASK) != 0 )
+                {
+                    *str = convertCase(*str, lower);
+                    str++;
+                    len--;
+                }
+                // Convert the aligned body word by word
+                Word* wp = reinterpret_cast<Word*>(str);
+                while(len >= sizeof(Word))
+                {
+                    *wp = lower ? toLowerCase(*wp) : toUpperCase(*wp);
+                    wp++;
+                    len -= sizeof(Word);
+                }
+                // Convert the tail byte by byte
+                str = reinterpret_cast<char*>(wp);
+                while(len-- != 0)
+                {
+                    *str = convertCase(*str, lower);
+                    str++;
+                }
+            }
+
+            /**
+             * Converts a Latin letter case.
+             *
+             * @param ch    a character to be converted.
+             * @param lower true for converting to lower case, and false for upper case.
+             * @return the converted character.
+             */
+            static char convertCase(const char ch, const bool lower)
+            {
+                char res = ch;
+                if(lower)
+                {
+                    if(ch >= 'A' && ch <= 'Z')
+                    {
+                        res = static_cast<char>(ch + ('a' - 'A'));
+                    }
+                }
+                else
+                {
+                    if(ch >= 'a' && ch <= 'z')
+                    {
+                        res = static_cast<char>(ch - ('a' - 'A'));
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Tests if the high bit of a byte is set.
+             *
+             * @param val a testing byte.
+             * @return true if the high bit is set.
+             */
+            static bool isHigh(const cell val)
+            {
+                return ( static_cast<ucell>(val) & 0x80U ) != 0 ? true : false;
+            }
+
+            /**
+             * Tests if two character arrays are equal.
+             *
+             * @param str1 a character array to be compared.
+             * @param str2 a character array to be compared.
+             * @param len  a number of characters to be compared.
+             * @return true if the arrays are equal.
+             */
+            static bool isEqual(const char* str1, const char* str2, int32 len)
+            {
+                while(len-- > 0)
+                {
+                    if(*str1++ != *str2++)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * Maximum number of fractional digits of a floating point number converted to a string.
+             */
+            static const int32 MAX_FLOAT_PRECISION = 9;
+
+            /**
+             * Tests if a floating point number is not a not-a-number or infinite value.
+             *
+             * @param val a value that would be tested.
+             * @return true if the value is finite.
+             */
+            static bool isFinite(const double val)
+            {
+                // The difference is not-a-number for not-a-number and infinite values only
+                const double diff = val - val;
+                return diff == diff ? true : false;
+            }
+
+            /**
+             * Splits a finite floating point number to integral and rounded fractional parts.
+             *
+             * @param val        a value that would be split.
+             * @param precision  a number of fractional digits.
+             * @param isNegative a resulting sign of the value.
+             * @param integral   a resulting integral part of the value.
+             * @param fraction   a resulting fractional part of the value multiplied by ten raised to the precision.
+             * @return true if the integral part does not exceed 64-bit unsigned integer.
+             */
+            static bool split(const double val, const int32 precision, bool& isNegative, uint64& integral, uint64& fraction)
+            {
+                // Two raised to the power of 64
+                const double LIMIT = 18446744073709551616.0;
+                const double module = val < 0.0 ? 0.0 - val : val;
+                if( not (module < LIMIT) )
+                {
+                    return false;
+                }
+                uint64 scale = 1;
+                for(int32 i=0; i<precision; i++)
+                {
+                    scale *= 10;
+                }
+                isNegative = val < 0.0 ? true : false;
+                integral = static_cast<uint64>(module);
+                fraction = static_cast<uint64>( ( module - static_cast<double>(integral) ) * static_cast<double>(scale) + 0.5 );
+                // Carry the rounding to the integral part
+                if(fraction >= scale)
+                {
+                    fraction -= scale;
+                    integral++;
+                }
+                return true;
+            }
+
             /**
              * Test if a value is signed or unsigned.
              *
@@ -366,9 +1134,9 @@ namespace local
                         return ch >= 0x30 && ch <= 0x37 ? true : false;
 
                     case 16:
-                        return ch >= 0x30 && ch <= 0x39
-                            || ch >= 0x41 && ch <= 0x46
-                            || ch >= 0x61 && ch <= 0x66 ? true : false;
+                        return ( ch >= 0x30 && ch <= 0x39 )
+                            || ( ch >= 0x41 && ch <= 0x46 )
+                            || ( ch >= 0x61 && ch <= 0x66 ) ? true : false;
 
                     case 10:
                         return ch >= 0x30 && ch <= 0x39 ? true : false;
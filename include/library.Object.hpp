@@ -10,6 +10,21 @@
 
 #include "Object.hpp"
 
+/**
+ * Final specifier of the library concrete classes.
+ *
+ * If the EOOS_FINAL_CLASSES macro is defined for C++11 builds, the concrete
+ * containers and strings cannot be derived, so that their methods called for
+ * objects of their concrete types are not dispatched virtually and can be inlined.
+ * Calls made inside the abstract parent classes are still dispatched virtually.
+ * The classes still implement the interfaces for calls which need polymorphism.
+ */
+#if defined(EOOS_FINAL_CLASSES) && __cplusplus >= 201103L
+#define LIBRARY_FINAL final
+#else
+#define LIBRARY_FINAL
+#endif // EOOS_FINAL_CLASSES && C++11
+
 namespace local
 {
     namespace library
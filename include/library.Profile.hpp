@@ -0,0 +1,136 @@
+/**
+ * Profile of the library operations.
+ *
+ * If the EOOS_PROFILE macro is defined, the heap, list and string operations
+ * are timed by the cycle timer, and elapsed ticks of each operation are recorded
+ * to a histogram of the operation. Otherwise, the LIBRARY_PROFILE hooks of
+ * the operations are removed. The histograms are merged and reset by a user,
+ * for example:
+ *
+ * Histogram<> snapshot( Profile::getHistogram(Profile::LIST_ADD) );
+ * uint64 const p99 = snapshot.getValueAtPercentile(99.0);
+ *
+ * NOTE: The histograms are not synchronized, so that the operations have
+ * to be profiled in one thread at a time.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_PROFILE_HPP_
+#define LIBRARY_PROFILE_HPP_
+
+#include "library.CycleTimer.hpp"
+#include "library.Histogram.hpp"
+
+#ifdef EOOS_PROFILE
+#define LIBRARY_PROFILE(operation) ::local::library::Profile::Scope const profile( ::local::library::Profile::operation )
+#else
+#define LIBRARY_PROFILE(operation)
+#endif // EOOS_PROFILE
+
+namespace local
+{
+    namespace library
+    {
+        class Profile
+        {
+
+        public:
+
+            /**
+             * Profiled operations.
+             */
+            enum Operation
+            {
+                HEAP_ALLOCATE      = 0,
+                HEAP_FREE          = 1,
+                LIST_ADD           = 2,
+                LIST_REMOVE        = 3,
+                STRING_COPY        = 4,
+                STRING_CONCATENATE = 5,
+                OPERATIONS         = 6
+            };
+
+            /**
+             * Timer of a scope recording elapsed ticks to a histogram of an operation.
+             */
+            class Scope
+            {
+
+            public:
+
+                /**
+                 * Constructor.
+                 *
+                 * @param operation - a timed operation.
+                 */
+                explicit Scope(Operation const operation) :
+                    operation_ (operation),
+                    timer_     (){
+                }
+
+                /**
+                 * Destructor.
+                 */
+               ~Scope()
+                {
+                    getHistogram(operation_).record( timer_.getElapsed() );
+                }
+
+            private:
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj - reference to source object.
+                 */
+                Scope(const Scope& obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj - reference to source object.
+                 * @return reference to this object.
+                 */
+                Scope& operator=(const Scope& obj);
+
+                /**
+                 * The timed operation.
+                 */
+                Operation operation_;
+
+                /**
+                 * The timer.
+                 */
+                CycleTimer timer_;
+
+            };
+
+            /**
+             * Returns a histogram of elapsed ticks of an operation.
+             *
+             * @param operation - an operation.
+             * @return the histogram.
+             */
+            static Histogram<>& getHistogram(Operation const operation)
+            {
+                static Histogram<> histograms[OPERATIONS];
+                return histograms[operation];
+            }
+
+            /**
+             * Resets histograms of all operations.
+             */
+            static void reset()
+            {
+                for(int32 i=0; i<OPERATIONS; i++)
+                {
+                    getHistogram( static_cast<Operation>(i) ).reset();
+                }
+            }
+
+        };
+    }
+}
+#endif // LIBRARY_PROFILE_HPP_
@@ -0,0 +1,199 @@
+/**
+ * Heap allocating memory in large chunks.
+ *
+ * The heap cuts memory from chunks allocated by a heap memory allocator class,
+ * frees nothing separately, and frees all the chunks when it is destroyed.
+ * Containers which allocate memory through the instance allocator in the heap,
+ * for example lists loaded from a buffer, get their nodes in a few allocations
+ * and place them next to each other:
+ *
+ * RegionHeap<> heap;
+ * LinkedList< int32, InstanceAllocator<> > list(heap);
+ *
+ * The containers have to be destroyed before the heap.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_REGION_HEAP_HPP_
+#define LIBRARY_REGION_HEAP_HPP_
+
+#include "library.Object.hpp"
+#include "api.Heap.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param A - heap memory allocator class.
+         */
+        template <class A = Allocator>
+        class RegionHeap : public library::Object<A>, public api::Heap
+        {
+            typedef library::Object<A> Parent;
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param chunk - number of bytes of a chunk.
+             */
+            explicit RegionHeap(size_t const chunk = 4096) : Parent(),
+                chunks_ (NULL),
+                top_    (NULL),
+                left_   (0),
+                chunk_  (chunk){
+            }
+
+            /**
+             * Destructor.
+             */
+            virtual ~RegionHeap()
+            {
+                while(chunks_ != NULL)
+                {
+                    Chunk* const next = chunks_->next;
+                    A::free(chunks_);
+                    chunks_ = next;
+                }
+            }
+
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */
+            virtual bool isConstructed() const
+            {
+                return this->isConstructed_;
+            }
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - required memory size in byte.
+             * @param ptr  - NULL value becomes to allocate memory, and
+             *               other given values are simply returned
+             *               as memory address.
+             * @return pointer to allocated memory or NULL.
+             */
+            virtual void* allocate(size_t const size, void* ptr)
+            {
+                if(ptr == NULL)
+                {
+                    // Align size to eight
+                    size_t const aligned = ( size + 7 ) & ~static_cast<size_t>(7);
+                    if( aligned < size || ( aligned > left_ && not createChunk(aligned) ) )
+                    {
+                        ptr = NULL;
+                    }
+                    else
+                    {
+                        ptr = top_;
+                        top_ = &top_[aligned];
+                        left_ -= aligned;
+                    }
+                }
+                return ptr;
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * Memory is freed when this heap is destroyed.
+             *
+             * @param ptr - pointer to allocated memory.
+             */
+            virtual void free(void*)
+            {
+            }
+
+        private:
+
+            /**
+             * Header of a chunk, which size is eight for keeping the memory aligned to eight.
+             */
+            union Chunk
+            {
+                /**
+                 * Next chunk.
+                 */
+                Chunk* next;
+
+                /**
+                 * Aligning data.
+                 */
+                int64 align;
+
+            };
+
+            /**
+             * Allocates a chunk.
+             *
+             * @param size - number of bytes to be allocated in the chunk.
+             * @return true if the chunk has been allocated.
+             */
+            bool createChunk(size_t const size)
+            {
+                bool res;
+                size_t const length = ( size > chunk_ ? size : chunk_ ) + sizeof(Chunk);
+                Chunk* const chunk = length > size ? reinterpret_cast<Chunk*>( A::allocate(length) ) : NULL;
+                if(chunk == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    chunk->next = chunks_;
+                    chunks_ = chunk;
+                    top_ = reinterpret_cast<cell*>(&chunk[1]);
+                    left_ = length - sizeof(Chunk);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            RegionHeap(const RegionHeap& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            RegionHeap& operator=(const RegionHeap& obj);
+
+            /**
+             * Allocated chunks.
+             */
+            Chunk* chunks_;
+
+            /**
+             * Free memory of the last chunk.
+             */
+            cell* top_;
+
+            /**
+             * Number of bytes of the free memory.
+             */
+            size_t left_;
+
+            /**
+             * Number of bytes of a chunk.
+             */
+            size_t chunk_;
+
+        };
+    }
+}
+#endif // LIBRARY_REGION_HEAP_HPP_
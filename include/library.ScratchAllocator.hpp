@@ -0,0 +1,251 @@
+/**
+ * Scratch memory allocator.
+ *
+ * The allocator serves memory from a static region as a stack. An allocation
+ * advances the top of the stack, freeing memory of the region does nothing,
+ * and the whole memory allocated after a mark is released at once by resetting
+ * the top to the mark. When the region is exhausted, memory is allocated by
+ * a passed allocator and freed as usual.
+ *
+ * The allocator is passed as a template argument of classes, which objects
+ * live in a scope guarded by a Scope object, for example:
+ *
+ * typedef ScratchAllocator<> Scratch;
+ * Scratch::Scope scope;
+ * String<char,0,Scratch> string("temporary");
+ *
+ * The objects have to be destroyed before the guard, thus they have to be
+ * declared after the guard in the same scope. If the EOOS_SCRATCH_THREAD_LOCAL
+ * macro is defined for a target which runtime supports thread-local storage of
+ * GCC compatible compilers, each thread has its own region; otherwise, the
+ * region must be used by one thread only. Each memory is preceded by a tag of
+ * the region or the passed allocator, so that memory is freed correctly by any
+ * thread.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SCRATCH_ALLOCATOR_HPP_
+#define LIBRARY_SCRATCH_ALLOCATOR_HPP_
+
+#include "Allocator.hpp"
+
+#ifdef EOOS_SCRATCH_THREAD_LOCAL
+#define LIBRARY_SCRATCH_ALLOCATOR_STORAGE __thread
+#else
+#define LIBRARY_SCRATCH_ALLOCATOR_STORAGE
+#endif // EOOS_SCRATCH_THREAD_LOCAL
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param S - number of bytes of the region.
+         * @param A - heap memory allocator class used when the region is exhausted.
+         */
+        template <int32 S = 4096, class A = Allocator>
+        class ScratchAllocator
+        {
+
+        public:
+
+            /**
+             * Guard of a scope releasing memory allocated in the scope.
+             */
+            class Scope
+            {
+
+            public:
+
+                /**
+                 * Constructor.
+                 */
+                Scope() :
+                    mark_ (getMark()){
+                }
+
+                /**
+                 * Destructor.
+                 */
+               ~Scope()
+                {
+                    release(mark_);
+                }
+
+            private:
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj - reference to source object.
+                 */
+                Scope(const Scope& obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj - reference to source object.
+                 * @return reference to this object.
+                 */
+                Scope& operator=(const Scope& obj);
+
+                /**
+                 * Top of the region at constructing.
+                 */
+                size_t mark_;
+
+            };
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size)
+            {
+                void* res;
+                Tag* tag;
+                size_t const aligned = ( size + ALIGN_MASK ) & ~ALIGN_MASK;
+                if( aligned >= size && aligned <= SIZE - top_ && SIZE - top_ - aligned >= sizeof(Tag) )
+                {
+                    cell* const region = reinterpret_cast<cell*>(region_);
+                    tag = reinterpret_cast<Tag*>( &region[top_] );
+                    tag->owner = REGION;
+                    top_ += sizeof(Tag) + aligned;
+                }
+                else if( size <= static_cast<size_t>(-1) - sizeof(Tag) )
+                {
+                    tag = reinterpret_cast<Tag*>( A::allocate(sizeof(Tag) + size) );
+                    if(tag != NULL)
+                    {
+                        tag->owner = ALLOCATOR;
+                    }
+                }
+                else
+                {
+                    tag = NULL;
+                }
+                res = tag != NULL ? &tag[1] : NULL;
+                return res;
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * Memory of the region is released by the release function only.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            static void free(void* const ptr)
+            {
+                // Memory of a region of any thread is not freed
+                if(ptr != NULL)
+                {
+                    Tag* const tag = &reinterpret_cast<Tag*>(ptr)[-1];
+                    if(tag->owner == ALLOCATOR)
+                    {
+                        A::free(tag);
+                    }
+                }
+            }
+
+            /**
+             * Returns the top of the region.
+             *
+             * @return a mark for releasing memory allocated after the call.
+             */
+            static size_t getMark()
+            {
+                return top_;
+            }
+
+            /**
+             * Releases memory of the region allocated after a mark.
+             *
+             * @param mark - a mark returned by the getMark function.
+             */
+            static void release(size_t const mark)
+            {
+                if(mark <= top_)
+                {
+                    top_ = mark;
+                }
+            }
+
+        private:
+
+            /**
+             * Owners of memory.
+             */
+            enum Owner
+            {
+                /**
+                 * Memory is allocated in a region.
+                 */
+                REGION    = 0x52454749,
+
+                /**
+                 * Memory is allocated by the passed allocator.
+                 */
+                ALLOCATOR = 0x414C4C4F
+            };
+
+            /**
+             * Tag preceding memory, which size is eight for keeping the memory aligned to eight.
+             */
+            union Tag
+            {
+                /**
+                 * Owner of the memory.
+                 */
+                Owner owner;
+
+                /**
+                 * Aligning data.
+                 */
+                int64 align;
+
+            };
+
+            /**
+             * Number of bytes of the region aligned to eight.
+             */
+            static const size_t SIZE = ( static_cast<size_t>(S) + 7U ) & ~static_cast<size_t>(7U);
+
+            /**
+             * Mask of unaligned bits of allocated memory size.
+             */
+            static const size_t ALIGN_MASK = 7U;
+
+            /**
+             * The region.
+             */
+            static LIBRARY_SCRATCH_ALLOCATOR_STORAGE int64 region_[SIZE / sizeof(int64)];
+
+            /**
+             * Number of allocated bytes of the region.
+             */
+            static LIBRARY_SCRATCH_ALLOCATOR_STORAGE size_t top_;
+
+        };
+
+        /**
+         * The region.
+         */
+        template <int32 S, class A>
+        LIBRARY_SCRATCH_ALLOCATOR_STORAGE int64 ScratchAllocator<S,A>::region_[ScratchAllocator<S,A>::SIZE / sizeof(int64)];
+
+        /**
+         * Number of allocated bytes of the region.
+         */
+        template <int32 S, class A>
+        LIBRARY_SCRATCH_ALLOCATOR_STORAGE size_t ScratchAllocator<S,A>::top_ = 0;
+
+    }
+}
+#endif // LIBRARY_SCRATCH_ALLOCATOR_HPP_
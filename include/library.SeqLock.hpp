@@ -0,0 +1,124 @@
+/**
+ * Sequence lock.
+ *
+ * The lock has a sequence number, which is odd while shared data is being
+ * written and is incremented by each writing. A reader does not lock anything,
+ * it reads the data between the beginRead and endRead functions, and reads
+ * the data again if the sequence number shows a writing has been occurred.
+ * Writers exclude each other by spinning on the sequence number.
+ *
+ * NOTE: A reader or writer must not preempt a writer on the same processor
+ * core, for example in an interrupt service routine, as it would spin forever.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SEQ_LOCK_HPP_
+#define LIBRARY_SEQ_LOCK_HPP_
+
+#include "library.Atomic.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        class SeqLock
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            SeqLock() :
+                sequence_ (0U){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~SeqLock()
+            {
+            }
+
+            /**
+             * Begins reading shared data.
+             *
+             * The function waits until a writing has been completed.
+             *
+             * @return the sequence number which has to be passed to the endRead function.
+             */
+            uint32 beginRead() const
+            {
+                uint32 sequence = sequence_.load(AtomicBase::ACQUIRE);
+                while( (sequence & 1U) != 0U )
+                {
+                    sequence = sequence_.load(AtomicBase::ACQUIRE);
+                }
+                return sequence;
+            }
+
+            /**
+             * Ends reading shared data.
+             *
+             * @param sequence - the sequence number returned by the beginRead function.
+             * @return true if the read data is consistent, or false if it has to be read again.
+             */
+            bool endRead(uint32 const sequence) const
+            {
+                // Loads of the data must not be reordered after loading the sequence number
+                AtomicBase::fence(AtomicBase::ACQUIRE);
+                return sequence_.load(AtomicBase::RELAXED) == sequence ? true : false;
+            }
+
+            /**
+             * Begins writing shared data.
+             *
+             * The function waits until another writing has been completed.
+             */
+            void beginWrite()
+            {
+                uint32 sequence = sequence_.load(AtomicBase::RELAXED);
+                while( (sequence & 1U) != 0U || not sequence_.compareExchangeWeak(sequence, sequence + 1U, AtomicBase::ACQUIRE) )
+                {
+                    sequence = sequence_.load(AtomicBase::RELAXED);
+                }
+                // Stores of the data must not be reordered before storing the odd sequence number
+                AtomicBase::fence(AtomicBase::RELEASE);
+            }
+
+            /**
+             * Ends writing shared data.
+             */
+            void endWrite()
+            {
+                static_cast<void>( sequence_.fetchAdd(1U, AtomicBase::RELEASE) );
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            SeqLock(const SeqLock& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            SeqLock& operator=(const SeqLock& obj);
+
+            /**
+             * The sequence number.
+             */
+            Atomic<uint32> sequence_;
+
+        };
+    }
+}
+#endif // LIBRARY_SEQ_LOCK_HPP_
@@ -0,0 +1,117 @@
+/**
+ * Value guarded by a sequence lock.
+ *
+ * The value is copied in by writers and copied out by readers, which retry
+ * copying while the value is being written. The value type is a small POD
+ * structure or a static buffer, which are copied by the assignment operator
+ * without allocating memory.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SEQ_LOCKED_HPP_
+#define LIBRARY_SEQ_LOCKED_HPP_
+
+#include "library.SeqLock.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - type of the value.
+         */
+        template <typename T>
+        class SeqLocked
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            SeqLocked() :
+                lock_  (),
+                value_ (){
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param value - an initial value.
+             */
+            explicit SeqLocked(const T& value) :
+                lock_  (),
+                value_ (){
+                value_ = value;
+            }
+
+            /**
+             * Destructor.
+             */
+           ~SeqLocked()
+            {
+            }
+
+            /**
+             * Copies the value out.
+             *
+             * @param value - a variable for the value.
+             */
+            void read(T& value) const
+            {
+                uint32 sequence;
+                do
+                {
+                    sequence = lock_.beginRead();
+                    value = value_;
+                }
+                while( not lock_.endRead(sequence) );
+            }
+
+            /**
+             * Copies a value in.
+             *
+             * @param value - a new value.
+             */
+            void write(const T& value)
+            {
+                lock_.beginWrite();
+                value_ = value;
+                lock_.endWrite();
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            SeqLocked(const SeqLocked<T>& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            SeqLocked<T>& operator=(const SeqLocked<T>& obj);
+
+            /**
+             * The lock.
+             */
+            SeqLock lock_;
+
+            /**
+             * The value.
+             */
+            T value_;
+
+        };
+    }
+}
+#endif // LIBRARY_SEQ_LOCKED_HPP_
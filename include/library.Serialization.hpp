@@ -0,0 +1,395 @@
+/**
+ * Binary serialization of lists and strings.
+ *
+ * Lists and strings are written to a buffer of bytes as records one by one.
+ * A record begins with a header of a number of elements and size of an element,
+ * which is followed by the elements, and a string record has a terminator
+ * after its characters. Records begin at offsets aligned to eight, so that
+ * elements of the records of a buffer allocated by an allocator are aligned.
+ *
+ * A record is read back by adding its elements to a list or copying the
+ * characters to a string, or is viewed in place without copying it. Nodes of
+ * a read list are allocated in bulk if the list allocates them in a region
+ * heap. The elements are copied as they are in memory, which is why they have
+ * to be simple values, and a buffer has to be read by a processor with the same
+ * byte order.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SERIALIZATION_HPP_
+#define LIBRARY_SERIALIZATION_HPP_
+
+#include "library.AbstractBuffer.hpp"
+#include "library.AbstractString.hpp"
+#include "library.StringView.hpp"
+#include "api.List.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param A - heap memory allocator class of buffers.
+         */
+        template <class A = Allocator>
+        class Serialization
+        {
+
+        public:
+
+            /**
+             * Returns size of a record of a list.
+             *
+             * @param list - a list.
+             * @return number of bytes, or -1 if the record is too large.
+             */
+            template <typename T>
+            static int32 getSize(const api::List<T>& list)
+            {
+                return getSize( list.getLength(), sizeof(T) );
+            }
+
+            /**
+             * Returns size of a record of a string.
+             *
+             * @param string - a string.
+             * @return number of bytes, or -1 if the record is too large.
+             */
+            template <typename T>
+            static int32 getSize(const api::String<T>& string)
+            {
+                return getSize( string.getLength() + 1, sizeof(T) );
+            }
+
+            /**
+             * Writes a record of a list.
+             *
+             * @param list   - a list.
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @return true if the record has been written.
+             */
+            template <typename T>
+            static bool write(api::List<T>& list, AbstractBuffer<cell,A>& buffer, int32& offset)
+            {
+                bool res;
+                int32 const length = list.getLength();
+                T* const elements = reinterpret_cast<T*>( writeHeader(buffer, offset, length, length, sizeof(T)) );
+                if(elements == NULL)
+                {
+                    res = false;
+                }
+                else if(length == 0)
+                {
+                    res = true;
+                }
+                else
+                {
+                    api::ListIterator<T>* const it = list.getListIterator(0);
+                    if(it == NULL)
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        // A circular list iterator never ends, so a number of elements is iterated
+                        for(int32 i=0; i<length; i++)
+                        {
+                            elements[i] = it->getNext();
+                        }
+                        delete it;
+                        res = true;
+                    }
+                }
+                if(res)
+                {
+                    offset += getSize(length, sizeof(T));
+                }
+                return res;
+            }
+
+            /**
+             * Writes a record of a string.
+             *
+             * @param string - a string.
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @return true if the record has been written.
+             */
+            template <typename T>
+            static bool write(const api::String<T>& string, AbstractBuffer<cell,A>& buffer, int32& offset)
+            {
+                bool res;
+                int32 const length = string.getLength();
+                T* const chars = reinterpret_cast<T*>( writeHeader(buffer, offset, length, length + 1, sizeof(T)) );
+                const T* const source = string.getChar();
+                // An empty string might have no characters allocated
+                if( chars == NULL || ( source == NULL && length > 0 ) )
+                {
+                    res = false;
+                }
+                else
+                {
+                    for(int32 i=0; i<length; i++)
+                    {
+                        chars[i] = source[i];
+                    }
+                    chars[length] = TERMINATOR;
+                    offset += getSize(length + 1, sizeof(T));
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Reads a record of a list by adding its elements to a list.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @param list   - a list.
+             * @return true if the record has been read.
+             */
+            template <typename T>
+            static bool read(const AbstractBuffer<cell,A>& buffer, int32& offset, api::List<T>& list)
+            {
+                bool res;
+                const T* elements;
+                int32 length;
+                int32 next = offset;
+                if( not view(buffer, next, elements, length) )
+                {
+                    res = false;
+                }
+                else
+                {
+                    res = true;
+                    for(int32 i=0; i<length && res; i++)
+                    {
+                        res = list.add(elements[i]);
+                    }
+                }
+                if(res)
+                {
+                    offset = next;
+                }
+                return res;
+            }
+
+            /**
+             * Reads a record of a string by copying its characters to a string.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @param string - a string.
+             * @return true if the record has been read.
+             */
+            template <typename T, int32 L, class B>
+            static bool read(const AbstractBuffer<cell,A>& buffer, int32& offset, AbstractString<T,L,B>& string)
+            {
+                bool res;
+                StringView<T> view;
+                int32 next = offset;
+                if( not Serialization<A>::view(buffer, next, view) )
+                {
+                    res = false;
+                }
+                else
+                {
+                    res = string.copy( view.getChar(), view.getLength() );
+                }
+                if(res)
+                {
+                    offset = next;
+                }
+                return res;
+            }
+
+            /**
+             * Views a record of a list in place.
+             *
+             * @param buffer   - a buffer.
+             * @param offset   - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @param elements - a variable for the first element, which is valid until the buffer is changed.
+             * @param length   - a variable for a number of the elements.
+             * @return true if the record has been viewed.
+             */
+            template <typename T>
+            static bool view(const AbstractBuffer<cell,A>& buffer, int32& offset, const T*& elements, int32& length)
+            {
+                bool res;
+                int32 count;
+                const cell* const data = readHeader(buffer, offset, count, sizeof(T));
+                if(data == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    elements = reinterpret_cast<const T*>(data);
+                    length = count;
+                    offset += getSize(count, sizeof(T));
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Views a record of a string in place.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record in the buffer, which is set to an offset of the next record.
+             * @param string - a view of the characters, which is valid until the buffer is changed.
+             * @return true if the record has been viewed.
+             */
+            template <typename T>
+            static bool view(const AbstractBuffer<cell,A>& buffer, int32& offset, StringView<T>& string)
+            {
+                bool res;
+                int32 count;
+                const cell* const data = readHeader(buffer, offset, count, sizeof(T));
+                const T* const chars = reinterpret_cast<const T*>(data);
+                // A string record has the characters followed by the terminator
+                if(data == NULL || count < 1 || chars[count - 1] != TERMINATOR)
+                {
+                    res = false;
+                }
+                else
+                {
+                    string = StringView<T>(chars, count - 1);
+                    offset += getSize(count, sizeof(T));
+                    res = true;
+                }
+                return res;
+            }
+
+        private:
+
+            /**
+             * Header of a record.
+             */
+            struct Header
+            {
+                /**
+                 * Number of elements.
+                 */
+                uint32 length;
+
+                /**
+                 * Size in byte of an element.
+                 */
+                uint32 size;
+
+            };
+
+            /**
+             * String terminator.
+             */
+            static const int32 TERMINATOR = 0;
+
+            /**
+             * Returns size of a record.
+             *
+             * @param count - number of elements.
+             * @param size  - size in byte of an element.
+             * @return number of bytes, or -1 if the record is too large.
+             */
+            static int32 getSize(int32 const count, size_t const size)
+            {
+                int32 res;
+                uint64 const bytes = sizeof(Header) + ( ( static_cast<uint64>(count) * size + 7U ) & ~static_cast<uint64>(7) );
+                if(count < 0 || bytes > 0x7FFFFFFFU)
+                {
+                    res = -1;
+                }
+                else
+                {
+                    res = static_cast<int32>(bytes);
+                }
+                return res;
+            }
+
+            /**
+             * Returns a memory of a buffer.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset aligned to eight.
+             * @param bytes  - number of bytes from the offset.
+             * @return the memory, or NULL if the buffer does not have the bytes.
+             */
+            static cell* getMemory(const AbstractBuffer<cell,A>& buffer, int32 const offset, int32 const bytes)
+            {
+                cell* res;
+                int32 const length = buffer.getLength();
+                if( not buffer.isConstructed() || offset < 0 || (offset & 7) != 0 || bytes < 0 || bytes > length - offset )
+                {
+                    res = NULL;
+                }
+                else
+                {
+                    res = &const_cast< AbstractBuffer<cell,A>& >(buffer)[offset];
+                }
+                return res;
+            }
+
+            /**
+             * Writes a header of a record.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record.
+             * @param length - number of elements of the header.
+             * @param count  - number of elements of the record.
+             * @param size   - size in byte of an element.
+             * @return the first element of the record, or NULL if the record does not fit the buffer.
+             */
+            static cell* writeHeader(AbstractBuffer<cell,A>& buffer, int32 const offset, int32 const length, int32 const count, size_t const size)
+            {
+                cell* res;
+                cell* const memory = getMemory( buffer, offset, getSize(count, size) );
+                if(memory == NULL || length < 0)
+                {
+                    res = NULL;
+                }
+                else
+                {
+                    Header* const header = reinterpret_cast<Header*>(memory);
+                    header->length = static_cast<uint32>(count);
+                    header->size = static_cast<uint32>(size);
+                    res = &memory[sizeof(Header)];
+                }
+                return res;
+            }
+
+            /**
+             * Reads a header of a record.
+             *
+             * @param buffer - a buffer.
+             * @param offset - an offset of the record.
+             * @param count  - a variable for a number of elements of the record.
+             * @param size   - size in byte of an expected element.
+             * @return the first element of the record, or NULL if the record is broken.
+             */
+            static const cell* readHeader(const AbstractBuffer<cell,A>& buffer, int32 const offset, int32& count, size_t const size)
+            {
+                const cell* res = NULL;
+                const cell* const memory = getMemory( buffer, offset, sizeof(Header) );
+                if(memory != NULL)
+                {
+                    const Header* const header = reinterpret_cast<const Header*>(memory);
+                    int32 const bytes = header->length <= 0x7FFFFFFFU ? getSize(static_cast<int32>(header->length), size) : -1;
+                    if( header->size == size && bytes >= 0 && getMemory(buffer, offset, bytes) != NULL )
+                    {
+                        count = static_cast<int32>(header->length);
+                        res = &memory[sizeof(Header)];
+                    }
+                }
+                return res;
+            }
+
+        };
+    }
+}
+#endif // LIBRARY_SERIALIZATION_HPP_
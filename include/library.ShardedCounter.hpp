@@ -0,0 +1,115 @@
+/**
+ * Counter sharded by processor cores.
+ *
+ * The counter has a shard for each core, and each shard is in own cache line,
+ * so that cores adding to the counter do not contend for one cache line.
+ * A value is added atomically to a shard of a passed index, and the counter
+ * value is the sum of all the shards.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_SHARDED_COUNTER_HPP_
+#define LIBRARY_SHARDED_COUNTER_HPP_
+
+#include "library.CacheAligned.hpp"
+#include "library.Atomic.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param S - number of shards.
+         * @param T - an integer type of the counter.
+         */
+        template <int32 S, typename T = uint64>
+        class ShardedCounter
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            ShardedCounter()
+            {
+            }
+
+            /**
+             * Destructor.
+             */
+           ~ShardedCounter()
+            {
+            }
+
+            /**
+             * Adds a value to a shard.
+             *
+             * @param shard - an index of the shard, for example the current core index, which is taken modulo number of shards.
+             * @param value - a value to add.
+             */
+            void add(int32 const shard, T const value)
+            {
+                uint32 const index = static_cast<uint32>(shard) % static_cast<uint32>(S);
+                static_cast<void>( shards_[index].get().fetchAdd(value, AtomicBase::RELAXED) );
+            }
+
+            /**
+             * Returns the value.
+             *
+             * The shards are read one by one, so the value might not include
+             * values being added at the same time.
+             *
+             * @return the sum of the shards.
+             */
+            T get() const
+            {
+                T res = 0;
+                for(int32 i=0; i<S; i++)
+                {
+                    res += shards_[i].get().load(AtomicBase::RELAXED);
+                }
+                return res;
+            }
+
+            /**
+             * Resets all shards.
+             */
+            void reset()
+            {
+                for(int32 i=0; i<S; i++)
+                {
+                    shards_[i].get().store(0, AtomicBase::RELAXED);
+                }
+            }
+
+        private:
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            ShardedCounter(const ShardedCounter<S,T>& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            ShardedCounter<S,T>& operator=(const ShardedCounter<S,T>& obj);
+
+            /**
+             * The shards.
+             */
+            CacheAligned< Atomic<T> > shards_[S];
+
+        };
+    }
+}
+#endif // LIBRARY_SHARDED_COUNTER_HPP_
@@ -0,0 +1,156 @@
+/**
+ * Allocator of standard library containers.
+ *
+ * The allocator meets the C++11 allocator requirements, so that standard
+ * containers of host tools allocate their memory through the library allocation
+ * of a heap memory allocator class, or in a heap for the instance allocator:
+ *
+ * std::vector< int, StdAllocator<int> > vector;
+ * std::vector< int, StdAllocator< int, InstanceAllocator<> > > vector( heap );
+ *
+ * If exceptions are enabled, the allocator throws std::bad_alloc when no memory
+ * is allocated, otherwise the allocator returns a null pointer.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_STD_ALLOCATOR_HPP_
+#define LIBRARY_STD_ALLOCATOR_HPP_
+
+#include "library.Allocation.hpp"
+
+#if __cplusplus >= 201103L
+
+#ifdef __EXCEPTIONS
+#include <new>
+#endif // __EXCEPTIONS
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - data type of allocated elements.
+         * @param A - heap memory allocator class.
+         */
+        template <typename T, class A = Allocator>
+        class StdAllocator : private Allocation<A>
+        {
+            typedef library::Allocation<A> Parent;
+
+            template <typename U, class B> friend class StdAllocator;
+
+        public:
+
+            /**
+             * Type of allocated elements.
+             */
+            typedef T value_type;
+
+            /**
+             * Constructor.
+             */
+            StdAllocator() noexcept : Parent()
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of elements, which is a heap for the instance allocator.
+             */
+            StdAllocator(const Allocation<A>& allocation) noexcept : Parent(allocation)
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * The constructor is used only by the instance allocator, which allocation is constructed of a heap.
+             *
+             * @param heap - a heap of elements.
+             */
+            StdAllocator(api::Heap& heap) noexcept : Parent(heap)
+            {
+            }
+
+            /**
+             * Constructor of an allocator of other elements.
+             *
+             * @param obj - a source allocator, which allocation is used by this allocator.
+             */
+            template <typename U>
+            StdAllocator(const StdAllocator<U,A>& obj) noexcept : Parent(obj)
+            {
+            }
+
+            /**
+             * Allocates memory of elements.
+             *
+             * @param count - number of elements.
+             * @return the first element.
+             */
+            T* allocate(size_t const count)
+            {
+                void* addr;
+                if( count > static_cast<size_t>(-1) / sizeof(T) )
+                {
+                    addr = NULL;
+                }
+                else
+                {
+                    addr = Parent::allocate(count * sizeof(T));
+                }
+                #ifdef __EXCEPTIONS
+                if(addr == NULL)
+                {
+                    throw std::bad_alloc();
+                }
+                #endif // __EXCEPTIONS
+                return reinterpret_cast<T*>(addr);
+            }
+
+            /**
+             * Frees memory of elements.
+             *
+             * @param ptr   - the first element.
+             * @param count - unused.
+             */
+            void deallocate(T* const ptr, size_t) noexcept
+            {
+                Parent::free(ptr);
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed allocator is freed by each of them.
+             *
+             * @param obj - an allocator.
+             * @return true if their allocations are equal.
+             */
+            template <typename U>
+            bool operator==(const StdAllocator<U,A>& obj) const noexcept
+            {
+                return Parent::operator==(obj);
+            }
+
+            /**
+             * Tests if memory allocated by this and a passed allocator is not freed by each of them.
+             *
+             * @param obj - an allocator.
+             * @return true if their allocations are not equal.
+             */
+            template <typename U>
+            bool operator!=(const StdAllocator<U,A>& obj) const noexcept
+            {
+                return Parent::operator!=(obj);
+            }
+
+        };
+    }
+}
+
+#endif // C++11
+#endif // LIBRARY_STD_ALLOCATOR_HPP_
@@ -23,7 +23,7 @@ namespace local
          * @param A - a heap memory allocator class.
          */
         template <typename T, int32 L, class A = Allocator>
-        class String : public library::AbstractString<T,L,A>
+        class String LIBRARY_FINAL : public library::AbstractString<T,L,A>
         {
             typedef library::String<T,L,A>         Self;
             typedef library::AbstractString<T,L,A> Parent;
@@ -45,6 +45,17 @@ namespace local
                 Parent::copy(source);
             }
 
+            /**
+             * Constructor.
+             *
+             * @param source - a first character of a source string, which is not needed to be terminated.
+             * @param length - a number of characters of the source string.
+             */
+            String(const T* const source, int32 const length) : Parent()
+            {
+                Parent::copy(source, length);
+            }
+
             /**
              * Destructor.
              */
@@ -73,7 +84,7 @@ namespace local
          * @param A - a heap memory allocator class.
          */
         template <int32 L, class A>
-        class String<char,L,A> : public library::AbstractString<char,L,A>
+        class String<char,L,A> LIBRARY_FINAL : public library::AbstractString<char,L,A>
         {
             typedef library::String<char,L,A>           Self;
             typedef library::AbstractString<char,L,A>   Parent;
@@ -117,6 +128,17 @@ namespace local
                 Parent::copy(source);
             }
 
+            /**
+             * Constructor.
+             *
+             * @param source - a first character of a source string, which is not needed to be terminated.
+             * @param length - a number of characters of the source string.
+             */
+            String(const char* const source, int32 const length) : Parent()
+            {
+                Parent::copy(source, length);
+            }
+
             /**
              * Constructor.
              *
@@ -218,8 +240,7 @@ namespace local
              */
             library::String<char,L,A>& operator+=(int32 const value)
             {
-                String const string(value);
-                Parent::concatenate(string);
+                concatenateInteger<int32>(value);
                 return *this;
             }
 
@@ -245,14 +266,76 @@ namespace local
             bool convert(I const value, int32 const base = 10)
             {
                 bool res;
-                char temp[sizeof(I) * 8 + 1];
-                if( not Memory::itoa<I>(value, temp, base) )
+                int32 const length = Memory::getIntegerLength<I>(value, base);
+                char* const str = length < 0 ? NULL : Parent::reserve(0, length);
+                if(str == NULL)
                 {
                     res = false;
                 }
                 else
                 {
-                    res = Parent::copy(temp);
+                    Memory::formatInteger<I>(value, str, length, base);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates an integer number to this string.
+             *
+             * The number is converted by the rules of the convert function directly
+             * to the end of this string, and its digits are padded with leading zeros
+             * up to a passed width, which does not include a minus sign.
+             *
+             * NOTE: You need to use "string.template concatenateInteger<I>(value, base, width);" syntax,
+             * if you have to specify the template argument type explicitly.
+             *
+             * @param value - a value that would be concatenated to this string.
+             * @param base  - a numerical base used to represent a value as a string.
+             * @param width - a minimum number of digits.
+             * @return true if the concatenation has been completed successfully.
+             */
+            template <typename I>
+            bool concatenateInteger(I const value, int32 const base = 10, int32 const width = 0)
+            {
+                bool res;
+                int32 const length = Memory::getIntegerLength<I>(value, base, width);
+                char* const str = length < 0 ? NULL : Parent::reserve(Parent::getLength(), length);
+                if(str == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    Memory::formatInteger<I>(value, str, length, base);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates a floating point number to this string.
+             *
+             * The number is represented in fixed-point notation with a passed number of
+             * fractional digits, and it is rounded half away from zero.
+             *
+             * @param value     - a value that would be concatenated to this string.
+             * @param precision - a number of fractional digits from 0 to 9.
+             * @return true if the concatenation has been completed successfully.
+             */
+            bool concatenateFloat(double const value, int32 const precision = 6)
+            {
+                bool res;
+                int32 const length = Memory::getFloatLength(value, precision);
+                char* const str = length < 0 ? NULL : Parent::reserve(Parent::getLength(), length);
+                if(str == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    Memory::formatFloat(value, str, length, precision);
+                    res = true;
                 }
                 return res;
             }
@@ -272,6 +355,103 @@ namespace local
                 return Memory::atoi<I>(Parent::getChar(), base);
             }
 
+            /**
+             * Converts Latin letters of this string to lower case.
+             *
+             * @return true if this string has been converted successfully.
+             */
+            bool toLowerCase()
+            {
+                return convertCase(true);
+            }
+
+            /**
+             * Converts Latin letters of this string to upper case.
+             *
+             * @return true if this string has been converted successfully.
+             */
+            bool toUpperCase()
+            {
+                return convertCase(false);
+            }
+
+            /**
+             * Compares this string with a passed string lexicographically ignoring case of Latin letters.
+             *
+             * @param str - a character string to be compared.
+             * @return the value 0 if a passed string is equal to this string;
+             *         a value less than 0 if this string is less than a passed string;
+             *         a value greater than 0 if this string is greater than a passed string,
+             *         or the minimum possible value if an error has been occurred.
+             */
+            int32 compareIgnoreCase(const char* const str) const
+            {
+                int32 res;
+                const char* const chr = Parent::getChar();
+                if( not Construction::isConstructed(*this) || chr == NULL || str == NULL )
+                {
+                    res = Parent::MINIMUM_POSSIBLE_VALUE_OF_INT32;
+                }
+                else
+                {
+                    int32 const len = Parent::getLength();
+                    res = len - static_cast<int32>( Memory::strlen(str) );
+                    // If lengths are equal, characters might be different
+                    if(res == 0)
+                    {
+                        res = Memory::compareIgnoreCase(chr, str, static_cast<size_t>(len));
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Compares this string with a passed string lexicographically ignoring case of Latin letters.
+             *
+             * @param obj - a string object to be compared.
+             * @return the value 0 if a passed string is equal to this string;
+             *         a value less than 0 if this string is less than a passed string;
+             *         a value greater than 0 if this string is greater than a passed string,
+             *         or the minimum possible value if an error has been occurred.
+             */
+            int32 compareIgnoreCase(const api::String<char>& obj) const
+            {
+                int32 res;
+                if( not obj.isConstructed() )
+                {
+                    res = Parent::MINIMUM_POSSIBLE_VALUE_OF_INT32;
+                }
+                else
+                {
+                    res = compareIgnoreCase( obj.getChar() );
+                }
+                return res;
+            }
+
+            /**
+             * Returns a hash code of this string.
+             *
+             * @return the hash code.
+             */
+            uint32 getHashCode() const
+            {
+                int32 const len = Parent::getLength();
+                return Memory::getHashCode(Parent::getChar(), static_cast<size_t>(len));
+            }
+
+            /**
+             * Returns a hash code of this string ignoring case of Latin letters.
+             *
+             * Strings equal ignoring case have equal hash codes.
+             *
+             * @return the hash code.
+             */
+            uint32 getHashCodeIgnoreCase() const
+            {
+                int32 const len = Parent::getLength();
+                return Memory::getHashCodeIgnoreCase(Parent::getChar(), static_cast<size_t>(len));
+            }
+
         protected:
 
             /**
@@ -286,6 +466,50 @@ namespace local
 
         private:
 
+            /**
+             * Converts Latin letters of this string case.
+             *
+             * @param lower - true for converting to lower case, and false for upper case.
+             * @return true if this string has been converted successfully.
+             */
+            bool convertCase(bool const lower)
+            {
+                bool res;
+                int32 const len = Parent::getLength();
+                if( not Construction::isConstructed(*this) )
+                {
+                    res = false;
+                }
+                else if(len == 0)
+                {
+                    // An empty string might have no characters allocated, and nothing is converted
+                    res = true;
+                }
+                else
+                {
+                    // Reserve no characters after this string to own its characters for modifying
+                    char* const end = Parent::reserve(len, 0);
+                    if(end == NULL)
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        char* const str = end - len;
+                        if(lower)
+                        {
+                            Memory::toLowerCase(str, static_cast<size_t>(len));
+                        }
+                        else
+                        {
+                            Memory::toUpperCase(str, static_cast<size_t>(len));
+                        }
+                        res = true;
+                    }
+                }
+                return res;
+            }
+
             template <int32 L0, class A0> friend bool operator==(const library::String<char,L0,A0>&, const char*);
             template <int32 L0, class A0> friend bool operator==(const char*, const library::String<char,L0,A0>&);
             template <int32 L0, class A0> friend bool operator!=(const library::String<char,L0,A0>&, const char*);
@@ -506,7 +730,7 @@ namespace local
          * @param A - a heap memory allocator class.
          */
         template <typename T, class A>
-        class String<T,0,A> : public library::AbstractString<T,0,A>
+        class String<T,0,A> LIBRARY_FINAL : public library::AbstractString<T,0,A>
         {
             typedef library::String<T,0,A>         Self;
             typedef library::AbstractString<T,0,A> Parent;
@@ -530,6 +754,63 @@ namespace local
                 Parent::copy(source);
             }
 
+            /**
+             * Constructor.
+             *
+             * @param source - a first character of a source string, which is not needed to be terminated.
+             * @param length - a number of characters of the source string.
+             */
+            String(const T* const source, int32 const length) : Parent()
+            {
+                Parent::copy(source, length);
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this string characters, which is a heap for the instance allocator.
+             */
+            explicit String(const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param source     - a source character string.
+             * @param allocation - an allocation of this string characters, which is a heap for the instance allocator.
+             */
+            String(const T* const source, const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+                Parent::copy(source);
+            }
+
+            #if __cplusplus >= 201103L
+
+            /**
+             * Move constructor.
+             *
+             * @param source - a source object which is empty after the construction.
+             */
+            String(library::String<T,0,A>&& source) : Parent()
+            {
+                Parent::move(source);
+            }
+
+            /**
+             * Move assignment operator.
+             *
+             * @param source - a source object which is empty after the assignment.
+             * @return reference to this object.
+             */
+            library::String<T,0,A>& operator=(library::String<T,0,A>&& source)
+            {
+                Parent::move(source);
+                return *this;
+            }
+
+            #endif // C++11
+
             /**
              * Destructor.
              */
@@ -557,7 +838,7 @@ namespace local
          * @param A - a heap memory allocator class.
          */
         template <class A>
-        class String<char,0,A> : public library::AbstractString<char,0,A>
+        class String<char,0,A> LIBRARY_FINAL : public library::AbstractString<char,0,A>
         {
             typedef library::String<char,0,A>         Self;
             typedef library::AbstractString<char,0,A> Parent;
@@ -578,9 +859,23 @@ namespace local
              */
             String(const library::String<char,0,A>& source) : Parent()
             {
-                Parent::copy(source);
+                Parent::share(source);
             }
 
+            #if __cplusplus >= 201103L
+
+            /**
+             * Move constructor.
+             *
+             * @param source - a source object which is empty after the construction.
+             */
+            String(library::String<char,0,A>&& source) : Parent()
+            {
+                Parent::move(source);
+            }
+
+            #endif // C++11
+
             /**
              * Constructor.
              *
@@ -601,6 +896,37 @@ namespace local
                 Parent::copy(source);
             }
 
+            /**
+             * Constructor.
+             *
+             * @param source - a first character of a source string, which is not needed to be terminated.
+             * @param length - a number of characters of the source string.
+             */
+            String(const char* const source, int32 const length) : Parent()
+            {
+                Parent::copy(source, length);
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param allocation - an allocation of this string characters, which is a heap for the instance allocator.
+             */
+            explicit String(const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param source     - a source character string.
+             * @param allocation - an allocation of this string characters, which is a heap for the instance allocator.
+             */
+            String(const char* const source, const library::Allocation<A>& allocation) : Parent(allocation)
+            {
+                Parent::copy(source);
+            }
+
             /**
              * Constructor.
              *
@@ -630,10 +956,26 @@ namespace local
              */
             library::String<char,0,A>& operator=(const library::String<char,0,A>& source)
             {
-                Parent::copy(source);
+                Parent::share(source);
                 return *this;
             }
 
+            #if __cplusplus >= 201103L
+
+            /**
+             * Move assignment operator.
+             *
+             * @param source - a source object which is empty after the assignment.
+             * @return reference to this object.
+             */
+            library::String<char,0,A>& operator=(library::String<char,0,A>&& source)
+            {
+                Parent::move(source);
+                return *this;
+            }
+
+            #endif // C++11
+
             /**
              * Assignment operator.
              *
@@ -702,8 +1044,7 @@ namespace local
              */
             library::String<char,0,A>& operator+=(int32 const value)
             {
-                String string(value);
-                Parent::concatenate(string);
+                concatenateInteger<int32>(value);
                 return *this;
             }
 
@@ -729,14 +1070,76 @@ namespace local
             bool convert(I const value, int32 const base = 10)
             {
                 bool res;
-                char temp[sizeof(I) * 8 + 1];
-                if( not Memory::itoa<I>(value, temp, base) )
+                int32 const length = Memory::getIntegerLength<I>(value, base);
+                char* const str = length < 0 ? NULL : Parent::reserve(0, length);
+                if(str == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    Memory::formatInteger<I>(value, str, length, base);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates an integer number to this string.
+             *
+             * The number is converted by the rules of the convert function directly
+             * to the end of this string, and its digits are padded with leading zeros
+             * up to a passed width, which does not include a minus sign.
+             *
+             * NOTE: You need to use "string.template concatenateInteger<I>(value, base, width);" syntax,
+             * if you have to specify the template argument type explicitly.
+             *
+             * @param value - a value that would be concatenated to this string.
+             * @param base  - a numerical base used to represent a value as a string.
+             * @param width - a minimum number of digits.
+             * @return true if the concatenation has been completed successfully.
+             */
+            template <typename I>
+            bool concatenateInteger(I const value, int32 const base = 10, int32 const width = 0)
+            {
+                bool res;
+                int32 const length = Memory::getIntegerLength<I>(value, base, width);
+                char* const str = length < 0 ? NULL : Parent::reserve(Parent::getLength(), length);
+                if(str == NULL)
                 {
                     res = false;
                 }
                 else
                 {
-                    res = Parent::copy(temp);
+                    Memory::formatInteger<I>(value, str, length, base);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Concatenates a floating point number to this string.
+             *
+             * The number is represented in fixed-point notation with a passed number of
+             * fractional digits, and it is rounded half away from zero.
+             *
+             * @param value     - a value that would be concatenated to this string.
+             * @param precision - a number of fractional digits from 0 to 9.
+             * @return true if the concatenation has been completed successfully.
+             */
+            bool concatenateFloat(double const value, int32 const precision = 6)
+            {
+                bool res;
+                int32 const length = Memory::getFloatLength(value, precision);
+                char* const str = length < 0 ? NULL : Parent::reserve(Parent::getLength(), length);
+                if(str == NULL)
+                {
+                    res = false;
+                }
+                else
+                {
+                    Memory::formatFloat(value, str, length, precision);
+                    res = true;
                 }
                 return res;
             }
@@ -757,6 +1160,103 @@ namespace local
                 return Memory::atoi<I>(str, base);
             }
 
+            /**
+             * Converts Latin letters of this string to lower case.
+             *
+             * @return true if this string has been converted successfully.
+             */
+            bool toLowerCase()
+            {
+                return convertCase(true);
+            }
+
+            /**
+             * Converts Latin letters of this string to upper case.
+             *
+             * @return true if this string has been converted successfully.
+             */
+            bool toUpperCase()
+            {
+                return convertCase(false);
+            }
+
+            /**
+             * Compares this string with a passed string lexicographically ignoring case of Latin letters.
+             *
+             * @param str - a character string to be compared.
+             * @return the value 0 if a passed string is equal to this string;
+             *         a value less than 0 if this string is less than a passed string;
+             *         a value greater than 0 if this string is greater than a passed string,
+             *         or the minimum possible value if an error has been occurred.
+             */
+            int32 compareIgnoreCase(const char* const str) const
+            {
+                int32 res;
+                const char* const chr = Parent::getChar();
+                if( not Construction::isConstructed(*this) || chr == NULL || str == NULL )
+                {
+                    res = Parent::MINIMUM_POSSIBLE_VALUE_OF_INT32;
+                }
+                else
+                {
+                    int32 const len = Parent::getLength();
+                    res = len - static_cast<int32>( Memory::strlen(str) );
+                    // If lengths are equal, characters might be different
+                    if(res == 0)
+                    {
+                        res = Memory::compareIgnoreCase(chr, str, static_cast<size_t>(len));
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Compares this string with a passed string lexicographically ignoring case of Latin letters.
+             *
+             * @param obj - a string object to be compared.
+             * @return the value 0 if a passed string is equal to this string;
+             *         a value less than 0 if this string is less than a passed string;
+             *         a value greater than 0 if this string is greater than a passed string,
+             *         or the minimum possible value if an error has been occurred.
+             */
+            int32 compareIgnoreCase(const api::String<char>& obj) const
+            {
+                int32 res;
+                if( not obj.isConstructed() )
+                {
+                    res = Parent::MINIMUM_POSSIBLE_VALUE_OF_INT32;
+                }
+                else
+                {
+                    res = compareIgnoreCase( obj.getChar() );
+                }
+                return res;
+            }
+
+            /**
+             * Returns a hash code of this string.
+             *
+             * @return the hash code.
+             */
+            uint32 getHashCode() const
+            {
+                int32 const len = Parent::getLength();
+                return Memory::getHashCode(Parent::getChar(), static_cast<size_t>(len));
+            }
+
+            /**
+             * Returns a hash code of this string ignoring case of Latin letters.
+             *
+             * Strings equal ignoring case have equal hash codes.
+             *
+             * @return the hash code.
+             */
+            uint32 getHashCodeIgnoreCase() const
+            {
+                int32 const len = Parent::getLength();
+                return Memory::getHashCodeIgnoreCase(Parent::getChar(), static_cast<size_t>(len));
+            }
+
         protected:
 
             /**
@@ -771,6 +1271,50 @@ namespace local
 
         private:
 
+            /**
+             * Converts Latin letters of this string case.
+             *
+             * @param lower - true for converting to lower case, and false for upper case.
+             * @return true if this string has been converted successfully.
+             */
+            bool convertCase(bool const lower)
+            {
+                bool res;
+                int32 const len = Parent::getLength();
+                if( not Construction::isConstructed(*this) )
+                {
+                    res = false;
+                }
+                else if(len == 0)
+                {
+                    // An empty string might have no characters allocated, and nothing is converted
+                    res = true;
+                }
+                else
+                {
+                    // Reserve no characters after this string to own its characters for modifying
+                    char* const end = Parent::reserve(len, 0);
+                    if(end == NULL)
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        char* const str = end - len;
+                        if(lower)
+                        {
+                            Memory::toLowerCase(str, static_cast<size_t>(len));
+                        }
+                        else
+                        {
+                            Memory::toUpperCase(str, static_cast<size_t>(len));
+                        }
+                        res = true;
+                    }
+                }
+                return res;
+            }
+
             template <class A0> friend bool operator==(const library::String<char,0,A0>&, const char*);
             template <class A0> friend bool operator==(const char*, const library::String<char,0,A0>&);
             template <class A0> friend bool operator!=(const library::String<char,0,A0>&, const char*);
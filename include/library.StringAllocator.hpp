@@ -0,0 +1,305 @@
+/**
+ * Size-class memory allocator for strings.
+ *
+ * The allocator rounds sizes of allocated memory up to power-of-two size classes,
+ * and each size class is served by its own pool of free blocks. The pools are
+ * refilled by chunks of blocks allocated by a passed allocator, and freed blocks
+ * are returned to their pools, so that frequently created and deleted strings
+ * are allocated in constant time and do not fragment the heap memory.
+ * Memory exceeding the largest size class is allocated by the passed allocator directly.
+ *
+ * The allocator is passed as a template argument of classes, for example,
+ * String<char,0,StringAllocator<> > string;
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_STRING_ALLOCATOR_HPP_
+#define LIBRARY_STRING_ALLOCATOR_HPP_
+
+#include "Allocator.hpp"
+#include "api.Toggle.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param A - heap memory allocator class of the pools.
+         * @param C - number of size classes, which are 16, 32, 64 and so on bytes including a block header.
+         * @param N - number of blocks allocated at once for refilling a pool.
+         */
+        template <class A = Allocator, int32 C = 6, int32 N = 16>
+        class StringAllocator
+        {
+
+        public:
+
+            /**
+             * Allocates memory.
+             *
+             * @param size - number of bytes to allocate.
+             * @return allocated memory address or a null pointer.
+             */
+            static void* allocate(size_t const size)
+            {
+                void* res;
+                size_t const total = size + sizeof(Header);
+                int32 const index = getIndex(total);
+                if(total < size)
+                {
+                    res = NULL;
+                }
+                else if(index == LARGE_INDEX)
+                {
+                    Header* const header = reinterpret_cast<Header*>( A::allocate(total) );
+                    res = createBlock(header, LARGE_INDEX);
+                }
+                else
+                {
+                    bool const is = disable();
+                    if(pools_[index] == NULL)
+                    {
+                        refill(index);
+                    }
+                    Block* const block = pools_[index];
+                    if(block != NULL)
+                    {
+                        pools_[index] = block->next;
+                    }
+                    enable(is);
+                    res = createBlock(reinterpret_cast<Header*>(block), index);
+                }
+                return res;
+            }
+
+            /**
+             * Frees an allocated memory.
+             *
+             * @param ptr - address of allocated memory block or a null pointer.
+             */
+            static void free(void* const ptr)
+            {
+                if(ptr == NULL)
+                {
+                    return;
+                }
+                Header* const header = reinterpret_cast<Header*>(ptr) - 1;
+                int32 const index = header->index;
+                if(index == LARGE_INDEX)
+                {
+                    A::free(header);
+                }
+                else
+                {
+                    Block* const block = reinterpret_cast<Block*>(header);
+                    bool const is = disable();
+                    block->next = pools_[index];
+                    pools_[index] = block;
+                    enable(is);
+                }
+            }
+
+            /**
+             * Sets a context switching locker.
+             *
+             * The method allows disabling and enabling thread context switching
+             * when the pools are being changed. Thus, the best way is to pass
+             * an interface of global interrupt toggling. The parameter type
+             * is reference to pointer, as when referenced pointer equals to NULL,
+             * no blocks are happening.
+             *
+             * @param toggle - reference to pointer to some controller.
+             */
+            static void setToggle(api::Toggle*& toggle)
+            {
+                toggle_ = &toggle;
+            }
+
+            /**
+             * Resets a context switching locker.
+             */
+            static void resetToggle()
+            {
+                toggle_ = NULL;
+            }
+
+        private:
+
+            /**
+             * Header of a block.
+             */
+            union Header
+            {
+                /**
+                 * Index of the size class of the block.
+                 */
+                int32 index;
+
+                /**
+                 * Alignment of the memory following the header.
+                 */
+                int64 align;
+
+            };
+
+            /**
+             * Free block of a pool.
+             */
+            struct Block
+            {
+                /**
+                 * Next free block of the pool.
+                 */
+                Block* next;
+
+            };
+
+            /**
+             * Size class index of memory exceeding the largest size class.
+             */
+            static const int32 LARGE_INDEX = -1;
+
+            /**
+             * Number of bytes of the smallest size class.
+             */
+            static const size_t MIN_BLOCK_SIZE = 16;
+
+            /**
+             * Returns a size class index.
+             *
+             * @param size - number of bytes of a block including its header.
+             * @return the size class index, or LARGE_INDEX if the size exceeds the largest size class.
+             */
+            static int32 getIndex(size_t const size)
+            {
+                int32 res = LARGE_INDEX;
+                for(int32 i=0; i<C; i++)
+                {
+                    if(size <= getBlockSize(i))
+                    {
+                        res = i;
+                        break;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Returns a number of bytes of blocks of a size class.
+             *
+             * @param index - a size class index.
+             * @return the number of bytes.
+             */
+            static size_t getBlockSize(int32 const index)
+            {
+                return MIN_BLOCK_SIZE << index;
+            }
+
+            /**
+             * Initializes a header of an allocated block.
+             *
+             * @param header - the header of the block, or a null pointer.
+             * @param index  - a size class index of the block.
+             * @return memory address following the header, or a null pointer.
+             */
+            static void* createBlock(Header* const header, int32 const index)
+            {
+                void* res;
+                if(header == NULL)
+                {
+                    res = NULL;
+                }
+                else
+                {
+                    header->index = index;
+                    res = header + 1;
+                }
+                return res;
+            }
+
+            /**
+             * Refills an empty pool by a chunk of blocks.
+             *
+             * Chunks are never returned to the allocator of the pools.
+             *
+             * @param index - a size class index of the pool.
+             */
+            static void refill(int32 const index)
+            {
+                size_t const size = getBlockSize(index);
+                cell* const chunk = reinterpret_cast<cell*>( A::allocate(size * N) );
+                if(chunk != NULL)
+                {
+                    for(int32 i=N-1; i>=0; i--)
+                    {
+                        Block* const block = reinterpret_cast<Block*>(chunk + size * i);
+                        block->next = pools_[index];
+                        pools_[index] = block;
+                    }
+                }
+            }
+
+            /**
+             * Disables a controller.
+             *
+             * @return an enable source bit value of a controller before method was called.
+             */
+            static bool disable()
+            {
+                if(toggle_ == NULL)
+                {
+                    return false;
+                }
+                api::Toggle* const toggle = *toggle_;
+                return toggle != NULL ? toggle->disable() : false;
+            }
+
+            /**
+             * Enables a controller.
+             *
+             * @param status - returned status by disable method.
+             */
+            static void enable(bool const status)
+            {
+                if(toggle_ == NULL)
+                {
+                    return;
+                }
+                api::Toggle* const toggle = *toggle_;
+                if(toggle != NULL)
+                {
+                    toggle->enable(status);
+                }
+            }
+
+            /**
+             * Free blocks of the size classes.
+             */
+            static Block* pools_[C];
+
+            /**
+             * Context switching locker.
+             */
+            static api::Toggle** toggle_;
+
+        };
+
+        /**
+         * Free blocks of the size classes.
+         */
+        template <class A, int32 C, int32 N>
+        typename StringAllocator<A,C,N>::Block* StringAllocator<A,C,N>::pools_[C];
+
+        /**
+         * Context switching locker.
+         */
+        template <class A, int32 C, int32 N>
+        api::Toggle** StringAllocator<A,C,N>::toggle_ = NULL;
+
+    }
+}
+#endif // LIBRARY_STRING_ALLOCATOR_HPP_
@@ -0,0 +1,160 @@
+/**
+ * Tokenizer of a string.
+ *
+ * The class breaks a string into tokens separated by a delimiter string,
+ * and returns each token as a view of the string characters without copying.
+ * For this reason, a string being tokenized and a delimiter have to exist
+ * and not to be changed until the tokenizer is used.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_STRING_TOKENIZER_HPP_
+#define LIBRARY_STRING_TOKENIZER_HPP_
+
+#include "library.StringView.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - a data type of string characters.
+         */
+        template <typename T>
+        class StringTokenizer
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * A string of N delimiters is broken into N + 1 tokens, so that
+             * empty tokens are returned for adjacent delimiters.
+             *
+             * @param str  - a first character of a string to be tokenized, or NULL for no tokens.
+             * @param len  - a number of characters of the string.
+             * @param dlm  - a first character of a delimiter.
+             * @param dlen - a number of characters of the delimiter.
+             */
+            StringTokenizer(const T* const str, int32 const len, const T* const dlm, int32 const dlen) :
+                str_  (str),
+                len_  (len),
+                dlm_  (dlm),
+                dlen_ (dlm != NULL && dlen > 0 ? dlen : 0),
+                pos_  (str != NULL && len >= 0 ? 0 : END_POSITION){
+            }
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - a source object.
+             */
+            StringTokenizer(const StringTokenizer<T>& obj) :
+                str_  (obj.str_),
+                len_  (obj.len_),
+                dlm_  (obj.dlm_),
+                dlen_ (obj.dlen_),
+                pos_  (obj.pos_){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~StringTokenizer()
+            {
+            }
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - a source object.
+             * @return reference to this object.
+             */
+            StringTokenizer<T>& operator=(const StringTokenizer<T>& obj)
+            {
+                str_  = obj.str_;
+                len_  = obj.len_;
+                dlm_  = obj.dlm_;
+                dlen_ = obj.dlen_;
+                pos_  = obj.pos_;
+                return *this;
+            }
+
+            /**
+             * Tests if this tokenizer may return a next token.
+             *
+             * @return true if next token is had.
+             */
+            bool hasNext() const
+            {
+                return pos_ != END_POSITION ? true : false;
+            }
+
+            /**
+             * Returns next token and advances this tokenizer position.
+             *
+             * @return a view of the token characters, or an empty view if no tokens left.
+             */
+            StringView<T> getNext()
+            {
+                StringView<T> token;
+                if( hasNext() )
+                {
+                    const T* const begin = &str_[pos_];
+                    int32 const rest = len_ - pos_;
+                    int32 const index = dlen_ != 0 ? Memory::getIndexOf(begin, rest, dlm_, dlen_) : -1;
+                    if(index < 0)
+                    {
+                        token = StringView<T>(begin, rest);
+                        pos_ = END_POSITION;
+                    }
+                    else
+                    {
+                        token = StringView<T>(begin, index);
+                        pos_ += index + dlen_;
+                    }
+                }
+                return token;
+            }
+
+        private:
+
+            /**
+             * Position of a finished tokenizer.
+             */
+            static const int32 END_POSITION = -1;
+
+            /**
+             * The first character of the tokenized string.
+             */
+            const T* str_;
+
+            /**
+             * Number of characters of the tokenized string.
+             */
+            int32 len_;
+
+            /**
+             * The first character of the delimiter.
+             */
+            const T* dlm_;
+
+            /**
+             * Number of characters of the delimiter.
+             */
+            int32 dlen_;
+
+            /**
+             * Index of the next token first character.
+             */
+            int32 pos_;
+
+        };
+    }
+}
+#endif // LIBRARY_STRING_TOKENIZER_HPP_
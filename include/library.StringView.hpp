@@ -0,0 +1,187 @@
+/**
+ * View of a string characters.
+ *
+ * The class refers to characters of a string which is owned by another object,
+ * and does not copy the characters. For this reason, a string being viewed
+ * has to exist and not to be changed until the view is used.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_STRING_VIEW_HPP_
+#define LIBRARY_STRING_VIEW_HPP_
+
+#include "library.Memory.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - a data type of string characters.
+         */
+        template <typename T>
+        class StringView
+        {
+
+        public:
+
+            /**
+             * Constructor.
+             */
+            StringView() :
+                str_ (NULL),
+                len_ (0){
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param str - a first character of a viewed string.
+             * @param len - a number of viewed characters.
+             */
+            StringView(const T* const str, int32 const len) :
+                str_ (str),
+                len_ (str != NULL && len > 0 ? len : 0){
+            }
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - a source object.
+             */
+            StringView(const StringView<T>& obj) :
+                str_ (obj.str_),
+                len_ (obj.len_){
+            }
+
+            /**
+             * Destructor.
+             */
+           ~StringView()
+            {
+            }
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - a source object.
+             * @return reference to this object.
+             */
+            StringView<T>& operator=(const StringView<T>& obj)
+            {
+                str_ = obj.str_;
+                len_ = obj.len_;
+                return *this;
+            }
+
+            /**
+             * Returns a number of viewed characters.
+             *
+             * @return number of characters.
+             */
+            int32 getLength() const
+            {
+                return len_;
+            }
+
+            /**
+             * Returns pointer to the first viewed character.
+             *
+             * NOTE: The viewed characters are not terminated.
+             *
+             * @return first character, or NULL if no characters viewed.
+             */
+            const T* getChar() const
+            {
+                return str_;
+            }
+
+            /**
+             * Tests if this view has characters.
+             *
+             * @return true if this view does not contain any characters.
+             */
+            bool isEmpty() const
+            {
+                return len_ == 0 ? true : false;
+            }
+
+            /**
+             * Returns a viewed character.
+             *
+             * @param index - a character index.
+             * @return a character.
+             */
+            const T& operator[](int32 const index) const
+            {
+                return str_[index];
+            }
+
+            /**
+             * Tests if this view is equal to a character array.
+             *
+             * @param str - a character array to be compared.
+             * @param len - a number of characters of the array.
+             * @return true if this view and the array have the same characters.
+             */
+            bool isEqual(const T* const str, int32 const len) const
+            {
+                bool res;
+                if( len != len_ )
+                {
+                    res = false;
+                }
+                else if( len == 0 )
+                {
+                    res = true;
+                }
+                else
+                {
+                    // The arrays of equal lengths are equal if one is found at the beginning of another
+                    res = Memory::getIndexOf(str_, len_, str, len) == 0 ? true : false;
+                }
+                return res;
+            }
+
+            /**
+             * Tests if this view is equal to another view.
+             *
+             * @param obj - a view to be compared.
+             * @return true if the views have the same characters.
+             */
+            bool isEqual(const StringView<T>& obj) const
+            {
+                return isEqual(obj.str_, obj.len_);
+            }
+
+            /**
+             * Returns the index of the first occurrence of a character in this view.
+             *
+             * @param ch - a character to be located.
+             * @return the index of the character, or -1 if this view does not contain the character.
+             */
+            int32 getIndexOf(const T& ch) const
+            {
+                return Memory::getIndexOf(str_, len_, ch);
+            }
+
+        private:
+
+            /**
+             * The first viewed character.
+             */
+            const T* str_;
+
+            /**
+             * Number of viewed characters.
+             */
+            int32 len_;
+
+        };
+    }
+}
+#endif // LIBRARY_STRING_VIEW_HPP_
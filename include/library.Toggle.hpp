@@ -10,6 +10,7 @@
 
 #include "library.Object.hpp"
 #include "api.Toggle.hpp"
+#include "library.Trace.hpp"
 
 namespace local
 {
@@ -93,7 +94,9 @@ namespace local
                     return false;
                 }
                 api::Toggle* const switcher = *toggle_;
-                return switcher->disable();
+                const bool status = switcher->disable();
+                LIBRARY_TRACE(TOGGLE_DISABLE, status, 0);
+                return status;
             }
 
             /**
@@ -109,6 +112,7 @@ namespace local
                 }
                 api::Toggle* const switcher = *toggle_;
                 switcher->enable(status);
+                LIBRARY_TRACE(TOGGLE_ENABLE, status, 0);
             }
 
         private:
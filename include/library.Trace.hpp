@@ -0,0 +1,213 @@
+/**
+ * Binary trace of events.
+ *
+ * The trace has a ring of fixed-size event records for each processor core.
+ * Events are written without locks and allocating memory, so that they are
+ * written from interrupt service routines, and an interrupt writing an event
+ * might preempt another writing on the same core. An event being overwritten
+ * is marked until it has been written completely.
+ *
+ * If the EOOS_TRACE macro is defined, the heap, toggle and list operations
+ * write their events by the LIBRARY_TRACE hooks to the trace of default
+ * template arguments, which are given by the EOOS_TRACE_CORES and
+ * EOOS_TRACE_EVENTS macros, and the EOOS_TRACE_CORE macro is an expression
+ * of the current core index. Otherwise, the hooks are removed, and the trace
+ * is not defined, as it needs the atomic built-in functions of GCC compatible
+ * compilers.
+ *
+ * The trace region is dumped to a file, for example by a debugger, and
+ * the dump is decoded by the trace tool into a timeline of the events.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_TRACE_HPP_
+#define LIBRARY_TRACE_HPP_
+
+#include "library.TraceFormat.hpp"
+#include "library.CycleTimer.hpp"
+
+#ifdef EOOS_TRACE
+#include "library.Atomic.hpp"
+#endif // EOOS_TRACE
+
+#ifndef EOOS_TRACE_CORES
+#define EOOS_TRACE_CORES 1
+#endif // EOOS_TRACE_CORES
+
+#ifndef EOOS_TRACE_EVENTS
+#define EOOS_TRACE_EVENTS 256
+#endif // EOOS_TRACE_EVENTS
+
+#ifndef EOOS_TRACE_CORE
+#define EOOS_TRACE_CORE 0
+#endif // EOOS_TRACE_CORE
+
+#ifdef EOOS_TRACE
+#define LIBRARY_TRACE(event, arg0, arg1) ::local::library::Trace<>::write( EOOS_TRACE_CORE, ::local::library::TraceFormat::event, static_cast< ::local::uint64 >(arg0), static_cast< ::local::uint64 >(arg1) )
+#else
+#define LIBRARY_TRACE(event, arg0, arg1)
+#endif // EOOS_TRACE
+
+#ifdef EOOS_TRACE
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param C - number of processor cores.
+         * @param N - number of events of a ring, which is a power of two.
+         */
+        template <int32 C = EOOS_TRACE_CORES, int32 N = EOOS_TRACE_EVENTS>
+        class Trace
+        {
+
+        public:
+
+            /**
+             * Writes an event.
+             *
+             * @param core - an index of the current processor core.
+             * @param id   - an identifier of the event.
+             * @param arg0 - the first argument of the event.
+             * @param arg1 - the second argument of the event.
+             */
+            static void write(int32 const core, uint32 const id, uint64 const arg0 = 0, uint64 const arg1 = 0)
+            {
+                if(0 <= core && core < C)
+                {
+                    Ring& ring = region_.rings[core];
+                    uint32 const index = ring.head.fetchAdd(1U, AtomicBase::RELAXED);
+                    TraceFormat::Event& event = ring.events[index & MASK];
+                    // Mark the event as being written for interrupts and readers
+                    event.sequence = 0;
+                    AtomicBase::signalFence();
+                    event.time = CycleTimer::getTicks();
+                    event.id = id;
+                    event.args[0] = arg0;
+                    event.args[1] = arg1;
+                    AtomicBase::signalFence();
+                    event.sequence = TraceFormat::getSequence(index);
+                }
+            }
+
+            /**
+             * Removes all events.
+             */
+            static void reset()
+            {
+                for(int32 i=0; i<C; i++)
+                {
+                    Ring& ring = region_.rings[i];
+                    ring.head.store(0U, AtomicBase::RELAXED);
+                    for(int32 j=0; j<N; j++)
+                    {
+                        ring.events[j].sequence = 0;
+                    }
+                }
+            }
+
+            /**
+             * Returns the trace region.
+             *
+             * @return the first byte of the region.
+             */
+            static const void* getData()
+            {
+                return &region_;
+            }
+
+            /**
+             * Returns size of the trace region.
+             *
+             * @return size in byte.
+             */
+            static size_t getSize()
+            {
+                return sizeof(region_);
+            }
+
+        private:
+
+            /**
+             * Mask of an index of an event in a ring.
+             */
+            static const uint32 MASK = static_cast<uint32>(N) - 1U;
+
+            /**
+             * Test of the number of events, which array size is negative if the number is not a power of two.
+             */
+            typedef char EventsTest[ ( N > 0 && (N & (N - 1)) == 0 ) ? 1 : -1 ];
+
+            /**
+             * Ring of events of a core.
+             */
+            struct Ring
+            {
+                /**
+                 * Number of events written to the ring, which is laid out as the ring header of the format.
+                 */
+                Atomic<uint32> head;
+
+                /**
+                 * Reserved data.
+                 */
+                uint32 reserved;
+
+                /**
+                 * The events.
+                 */
+                TraceFormat::Event events[N];
+
+            };
+
+            /**
+             * The trace region.
+             */
+            struct Region
+            {
+                /**
+                 * Header of the trace.
+                 */
+                TraceFormat::Header header;
+
+                /**
+                 * The rings.
+                 */
+                Ring rings[C];
+
+            };
+
+            /**
+             * The trace region.
+             */
+            static Region region_;
+
+        };
+
+        /**
+         * The trace region.
+         */
+        template <int32 C, int32 N>
+        typename Trace<C,N>::Region Trace<C,N>::region_ = {
+            {
+                TraceFormat::MAGIC,
+                TraceFormat::VERSION,
+                static_cast<uint32>(C),
+                static_cast<uint32>(N),
+                static_cast<uint32>( sizeof(TraceFormat::Event) ),
+                static_cast<uint32>( sizeof(typename Trace<C,N>::Ring) ),
+                {0, 0}
+            },
+            {}
+        };
+
+    }
+}
+
+#endif // EOOS_TRACE
+#endif // LIBRARY_TRACE_HPP_
@@ -0,0 +1,183 @@
+/**
+ * Binary format of trace events.
+ *
+ * A trace is a region of memory which begins with a header followed by rings
+ * of events of processor cores in order of the core indexes. A ring begins
+ * with a number of events written to the ring followed by the events, and
+ * the oldest events are overwritten when the ring is full. The format is used
+ * by the trace writing events and by tools decoding dumps of the trace region.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_TRACE_FORMAT_HPP_
+#define LIBRARY_TRACE_FORMAT_HPP_
+
+#include "Types.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        class TraceFormat
+        {
+
+        public:
+
+            /**
+             * Magic number of the trace header, which is "EOTR" in memory of little-endian processors.
+             */
+            static const uint32 MAGIC = 0x52544F45U;
+
+            /**
+             * Version of the format.
+             */
+            static const uint32 VERSION = 1U;
+
+            /**
+             * Identifiers of events.
+             */
+            enum Id
+            {
+                /**
+                 * Memory has been allocated by a heap, the arguments are size and address.
+                 */
+                HEAP_ALLOCATE  = 1,
+
+                /**
+                 * Memory has been freed by a heap, the argument is address.
+                 */
+                HEAP_FREE      = 2,
+
+                /**
+                 * A toggle has been disabled, the argument is the previous status.
+                 */
+                TOGGLE_DISABLE = 3,
+
+                /**
+                 * A toggle has been enabled, the argument is the restored status.
+                 */
+                TOGGLE_ENABLE  = 4,
+
+                /**
+                 * An element has been added to a list or queue, the arguments are index and length.
+                 */
+                LIST_ADD       = 5,
+
+                /**
+                 * An element has been removed from a list or queue, the argument is length.
+                 */
+                LIST_REMOVE    = 6,
+
+                /**
+                 * The first identifier of user events.
+                 */
+                USER           = 0x100
+            };
+
+            /**
+             * Header of a trace.
+             */
+            struct Header
+            {
+                /**
+                 * The magic number.
+                 */
+                uint32 magic;
+
+                /**
+                 * The format version.
+                 */
+                uint32 version;
+
+                /**
+                 * Number of rings.
+                 */
+                uint32 cores;
+
+                /**
+                 * Number of events of a ring.
+                 */
+                uint32 events;
+
+                /**
+                 * Size in byte of an event.
+                 */
+                uint32 eventSize;
+
+                /**
+                 * Size in byte of a ring.
+                 */
+                uint32 ringSize;
+
+                /**
+                 * Reserved data.
+                 */
+                uint32 reserved[2];
+
+            };
+
+            /**
+             * Event record.
+             */
+            struct Event
+            {
+                /**
+                 * Ticks of the cycle timer.
+                 */
+                uint64 time;
+
+                /**
+                 * Sequence number of the event in its ring, or zero while the event is being written.
+                 */
+                uint32 sequence;
+
+                /**
+                 * Identifier of the event.
+                 */
+                uint32 id;
+
+                /**
+                 * Arguments of the event.
+                 */
+                uint64 args[2];
+
+            };
+
+            /**
+             * Header of a ring.
+             */
+            struct Ring
+            {
+                /**
+                 * Number of events written to the ring.
+                 */
+                uint32 head;
+
+                /**
+                 * Reserved data.
+                 */
+                uint32 reserved;
+
+            };
+
+            /**
+             * Returns a sequence number of an event.
+             *
+             * The number is the event number counting from one,
+             * and zero is skipped when the number wraps around.
+             *
+             * @param index - a number of the event counting from zero.
+             * @return the sequence number.
+             */
+            static uint32 getSequence(uint32 const index)
+            {
+                uint32 const res = index + 1U;
+                return res != 0U ? res : 1U;
+            }
+
+        };
+    }
+}
+#endif // LIBRARY_TRACE_FORMAT_HPP_
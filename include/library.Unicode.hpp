@@ -0,0 +1,357 @@
+/**
+ * Class of static methods to validate and transcode Unicode strings.
+ *
+ * Code units of UTF-8, UTF-16 and UTF-32 encoded strings are selected by sizes
+ * of the code unit types, which have to be one, two or four bytes correspondingly.
+ * A code unit type has to be convertible from and to 32-bit unsigned integer.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_UNICODE_HPP_
+#define LIBRARY_UNICODE_HPP_
+
+#include "library.Memory.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        class Unicode
+        {
+
+        public:
+
+            /**
+             * Tests if a string is valid UTF-8.
+             *
+             * Overlong sequences, surrogate code points, and code points
+             * greater than U+10FFFF are not valid.
+             *
+             * @param str a UTF-8 string to be tested.
+             * @param len a number of bytes of the string.
+             * @return true if the string is valid.
+             */
+            static bool isValid(const char* const str, const int32 len)
+            {
+                return getCodePointCount(str, len) >= 0 ? true : false;
+            }
+
+            /**
+             * Returns a number of code points of a UTF-8 string.
+             *
+             * @param str a UTF-8 string to be measured.
+             * @param len a number of bytes of the string.
+             * @return the number of code points, or -1 if the string is not valid.
+             */
+            static int32 getCodePointCount(const char* const str, const int32 len)
+            {
+                uint32* const dst = NULL;
+                return transcode(str, len, dst);
+            }
+
+            /**
+             * Transcodes a Unicode string.
+             *
+             * A passed string is validated while it is transcoded. If a destination
+             * array is NULL, the function only validates the string and returns
+             * a number of code units needed for the destination string.
+             * Thus, a destination array can be sized before the transcoding.
+             *
+             * @param src a source string.
+             * @param len a number of code units of the source string.
+             * @param dst a destination array, or NULL.
+             * @return a number of code units of the destination string, or -1 if the source string is not valid.
+             */
+            template <typename S, typename D>
+            static int32 transcode(const S* const src, const int32 len, D* const dst)
+            {
+                if( src == NULL || len < 0 || not isUnit<S>() || not isUnit<D>() )
+                {
+                    return -1;
+                }
+                int32 i = 0;
+                int32 n = 0;
+                while(i < len)
+                {
+                    // Do fast pass of 7-bit characters of a UTF-8 string
+                    if(sizeof(S) == 1)
+                    {
+                        const size_t rest = static_cast<size_t>(len - i);
+                        const int32 count = static_cast<int32>( Memory::getAsciiLength(&src[i], rest) );
+                        if(dst != NULL)
+                        {
+                            for(int32 j=0; j<count; j++)
+                            {
+                                dst[n + j] = static_cast<D>( getUnit(src[i + j]) );
+                            }
+                        }
+                        i += count;
+                        n += count;
+                        if(i == len)
+                        {
+                            break;
+                        }
+                    }
+                    uint32 cp;
+                    if( not decode(src, len, i, cp) )
+                    {
+                        return -1;
+                    }
+                    n += encode(cp, dst, n);
+                }
+                return n;
+            }
+
+        private:
+
+            /**
+             * Tests if a type is a code unit type.
+             *
+             * @return true if size of the type is one, two or four.
+             */
+            template <typename U>
+            static bool isUnit()
+            {
+                return sizeof(U) == 1 || sizeof(U) == 2 || sizeof(U) == 4 ? true : false;
+            }
+
+            /**
+             * Returns a code unit value.
+             *
+             * @param unit a code unit.
+             * @return the value of the code unit.
+             */
+            template <typename U>
+            static uint32 getUnit(const U& unit)
+            {
+                uint32 val = static_cast<uint32>(unit);
+                if(sizeof(U) == 1)
+                {
+                    val &= 0x000000FFU;
+                }
+                else if(sizeof(U) == 2)
+                {
+                    val &= 0x0000FFFFU;
+                }
+                return val;
+            }
+
+            /**
+             * Decodes a code point of a string.
+             *
+             * @param src a source string.
+             * @param len a number of code units of the source string.
+             * @param i   an index of the first code unit, which is advanced to the next code point.
+             * @param cp  a resulting code point.
+             * @return true if the code point is valid.
+             */
+            template <typename S>
+            static bool decode(const S* const src, const int32 len, int32& i, uint32& cp)
+            {
+                bool res;
+                switch( sizeof(S) )
+                {
+                    case 1:
+                    {
+                        res = decodeUtf8(src, len, i, cp);
+                        break;
+                    }
+                    case 2:
+                    {
+                        res = decodeUtf16(src, len, i, cp);
+                        break;
+                    }
+                    default:
+                    {
+                        cp = getUnit(src[i++]);
+                        res = isScalar(cp);
+                        break;
+                    }
+                }
+                return res;
+            }
+
+            /**
+             * Decodes a code point of a UTF-8 string.
+             *
+             * Valid ranges of the second byte depend on the first byte of a sequence,
+             * and these ranges exclude overlong sequences, surrogates and code points
+             * beyond U+10FFFF.
+             *
+             * @param src a source string.
+             * @param len a number of code units of the source string.
+             * @param i   an index of the first code unit, which is advanced to the next code point.
+             * @param cp  a resulting code point.
+             * @return true if the code point is valid.
+             */
+            template <typename S>
+            static bool decodeUtf8(const S* const src, const int32 len, int32& i, uint32& cp)
+            {
+                const uint32 lead = getUnit(src[i]);
+                int32 count;
+                uint32 low = 0x80U;
+                uint32 high = 0xBFU;
+                if(lead < 0x80U)
+                {
+                    cp = lead;
+                    i += 1;
+                    return true;
+                }
+                else if(lead < 0xC2U)
+                {
+                    return false;
+                }
+                else if(lead < 0xE0U)
+                {
+                    count = 2;
+                    cp = lead & 0x1FU;
+                }
+                else if(lead < 0xF0U)
+                {
+                    count = 3;
+                    cp = lead & 0x0FU;
+                    low  = lead == 0xE0U ? 0xA0U : low;
+                    high = lead == 0xEDU ? 0x9FU : high;
+                }
+                else if(lead < 0xF5U)
+                {
+                    count = 4;
+                    cp = lead & 0x07U;
+                    low  = lead == 0xF0U ? 0x90U : low;
+                    high = lead == 0xF4U ? 0x8FU : high;
+                }
+                else
+                {
+                    return false;
+                }
+                if(count > len - i)
+                {
+                    return false;
+                }
+                for(int32 j=1; j<count; j++)
+                {
+                    const uint32 unit = getUnit(src[i + j]);
+                    if(unit < low || unit > high)
+                    {
+                        return false;
+                    }
+                    cp = (cp << 6) | (unit & 0x3FU);
+                    low = 0x80U;
+                    high = 0xBFU;
+                }
+                i += count;
+                return true;
+            }
+
+            /**
+             * Decodes a code point of a UTF-16 string.
+             *
+             * @param src a source string.
+             * @param len a number of code units of the source string.
+             * @param i   an index of the first code unit, which is advanced to the next code point.
+             * @param cp  a resulting code point.
+             * @return true if the code point is valid.
+             */
+            template <typename S>
+            static bool decodeUtf16(const S* const src, const int32 len, int32& i, uint32& cp)
+            {
+                const uint32 unit = getUnit(src[i]);
+                if(unit < 0xD800U || unit > 0xDFFFU)
+                {
+                    cp = unit;
+                    i += 1;
+                    return true;
+                }
+                // A low surrogate must follow a high surrogate
+                if(unit > 0xDBFFU || i + 1 >= len)
+                {
+                    return false;
+                }
+                const uint32 next = getUnit(src[i + 1]);
+                if(next < 0xDC00U || next > 0xDFFFU)
+                {
+                    return false;
+                }
+                cp = 0x10000U + ( (unit - 0xD800U) << 10 ) + (next - 0xDC00U);
+                i += 2;
+                return true;
+            }
+
+            /**
+             * Encodes a code point to a string.
+             *
+             * @param cp  a code point.
+             * @param dst a destination array, or NULL for calculating a number of code units only.
+             * @param n   an index of the first code unit in the destination array.
+             * @return a number of code units of the encoded code point.
+             */
+            template <typename D>
+            static int32 encode(const uint32 cp, D* const dst, const int32 n)
+            {
+                int32 count;
+                switch( sizeof(D) )
+                {
+                    case 1:
+                    {
+                        count = cp < 0x80U ? 1 : cp < 0x800U ? 2 : cp < 0x10000U ? 3 : 4;
+                        if(dst != NULL)
+                        {
+                            static const uint32 LEADS[] = {0x00U, 0x00U, 0xC0U, 0xE0U, 0xF0U};
+                            uint32 val = cp;
+                            for(int32 j=count-1; j>0; j--)
+                            {
+                                dst[n + j] = static_cast<D>( 0x80U | (val & 0x3FU) );
+                                val >>= 6;
+                            }
+                            dst[n] = static_cast<D>( LEADS[count] | val );
+                        }
+                        break;
+                    }
+                    case 2:
+                    {
+                        count = cp < 0x10000U ? 1 : 2;
+                        if(dst != NULL)
+                        {
+                            if(count == 1)
+                            {
+                                dst[n] = static_cast<D>(cp);
+                            }
+                            else
+                            {
+                                const uint32 val = cp - 0x10000U;
+                                dst[n] = static_cast<D>( 0xD800U + (val >> 10) );
+                                dst[n + 1] = static_cast<D>( 0xDC00U + (val & 0x3FFU) );
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        count = 1;
+                        if(dst != NULL)
+                        {
+                            dst[n] = static_cast<D>(cp);
+                        }
+                        break;
+                    }
+                }
+                return count;
+            }
+
+            /**
+             * Tests if a code point is a Unicode scalar value.
+             *
+             * @param cp a code point.
+             * @return true if the code point is not a surrogate and does not exceed U+10FFFF.
+             */
+            static bool isScalar(const uint32 cp)
+            {
+                return cp <= 0x10FFFFU && (cp < 0xD800U || cp > 0xDFFFU) ? true : false;
+            }
+
+        };
+    }
+}
+#endif // LIBRARY_UNICODE_HPP_
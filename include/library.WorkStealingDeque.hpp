@@ -0,0 +1,440 @@
+/**
+ * Work-stealing deque.
+ *
+ * The deque is the Chase-Lev deque of a worker thread. The owner thread pushes
+ * and pops elements at the bottom end without locks, and other threads steal
+ * elements at the top end by the compare-and-swap of the top index, so that the
+ * owner contends with thieves only for the last element.
+ *
+ * The elements are kept in a ring buffer, which is replaced by a buffer of
+ * double capacity when it is full. Thieves might still read a replaced buffer,
+ * so that the replaced buffers are freed only when the deque is destroyed,
+ * and all the buffers take less than twice the largest one.
+ *
+ * NOTE: The elements are copied without synchronization to memory which is
+ * not constructed, which is why they have to be simple values like pointers
+ * to tasks.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#ifndef LIBRARY_WORK_STEALING_DEQUE_HPP_
+#define LIBRARY_WORK_STEALING_DEQUE_HPP_
+
+#include "library.Object.hpp"
+#include "library.Allocation.hpp"
+#include "library.Atomic.hpp"
+#include "library.CacheAligned.hpp"
+
+namespace local
+{
+    namespace library
+    {
+        /**
+         * Primary template implementation.
+         *
+         * @param T - data type of deque element.
+         * @param A - heap memory allocator class.
+         */
+        template <typename T, class A = Allocator>
+        class WorkStealingDeque : public library::Object<A>
+        {
+            typedef library::Object<A> Parent;
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * @param capacity - an initial number of elements, which is a power of two.
+             */
+            explicit WorkStealingDeque(int32 const capacity = 64) : Parent(),
+                top_    (),
+                bottom_ (),
+                array_  (){
+                const bool isConstructed = construct(capacity);
+                this->setConstructed( isConstructed );
+            }
+
+            /**
+             * Destructor.
+             */
+            virtual ~WorkStealingDeque()
+            {
+                Array* array = array_.load(AtomicBase::RELAXED);
+                while(array != NULL)
+                {
+                    Array* const retired = array->getRetired();
+                    delete array;
+                    array = retired;
+                }
+            }
+
+            /**
+             * Tests if this object has been constructed.
+             *
+             * @return true if object has been constructed successfully.
+             */
+            virtual bool isConstructed() const
+            {
+                return this->isConstructed_;
+            }
+
+            /**
+             * Pushes an element to the bottom of this deque.
+             *
+             * The function is called only by the owner thread.
+             *
+             * @param element - an element.
+             * @return true if the element has been pushed, or false if no memory.
+             */
+            bool push(const T& element)
+            {
+                bool res;
+                intptr const b = bottom_.get().load(AtomicBase::RELAXED);
+                intptr const t = top_.get().load(AtomicBase::ACQUIRE);
+                Array* array = array_.load(AtomicBase::RELAXED);
+                if( b - t >= array->getCapacity() )
+                {
+                    array = grow(array, t, b);
+                }
+                if( array == NULL )
+                {
+                    res = false;
+                }
+                else
+                {
+                    array->put(b, element);
+                    // The element must be stored before it is published for thieves
+                    AtomicBase::fence(AtomicBase::RELEASE);
+                    bottom_.get().store(b + 1, AtomicBase::RELAXED);
+                    res = true;
+                }
+                return res;
+            }
+
+            /**
+             * Pops an element from the bottom of this deque.
+             *
+             * The function is called only by the owner thread.
+             *
+             * @param element - a variable for the element.
+             * @return true if the element has been popped, or false if this deque is empty.
+             */
+            bool pop(T& element)
+            {
+                bool res;
+                intptr const b = bottom_.get().load(AtomicBase::RELAXED) - 1;
+                Array* const array = array_.load(AtomicBase::RELAXED);
+                bottom_.get().store(b, AtomicBase::RELAXED);
+                // Reserving the bottom element must be ordered with thieves reserving the top one
+                AtomicBase::fence(AtomicBase::SEQ_CST);
+                intptr t = top_.get().load(AtomicBase::RELAXED);
+                if( t < b )
+                {
+                    element = array->get(b);
+                    res = true;
+                }
+                else if( t == b )
+                {
+                    // The last element is given to the owner or to a thief
+                    element = array->get(b);
+                    res = top_.get().compareExchange(t, t + 1, AtomicBase::SEQ_CST);
+                    bottom_.get().store(b + 1, AtomicBase::RELAXED);
+                }
+                else
+                {
+                    bottom_.get().store(b + 1, AtomicBase::RELAXED);
+                    res = false;
+                }
+                return res;
+            }
+
+            /**
+             * Steals an element from the top of this deque.
+             *
+             * The function is called by any thread.
+             *
+             * @param element - a variable for the element.
+             * @return true if the element has been stolen, or false if this deque is empty or another thread has taken the element.
+             */
+            bool steal(T& element)
+            {
+                bool res;
+                intptr t = top_.get().load(AtomicBase::ACQUIRE);
+                AtomicBase::fence(AtomicBase::SEQ_CST);
+                intptr const b = bottom_.get().load(AtomicBase::ACQUIRE);
+                if( t < b )
+                {
+                    Array* const array = array_.load(AtomicBase::ACQUIRE);
+                    element = array->get(t);
+                    res = top_.get().compareExchange(t, t + 1, AtomicBase::SEQ_CST);
+                }
+                else
+                {
+                    res = false;
+                }
+                return res;
+            }
+
+            /**
+             * Returns a number of elements.
+             *
+             * The number is approximate while other threads use this deque.
+             *
+             * @return number of elements.
+             */
+            int32 getLength() const
+            {
+                intptr const b = bottom_.get().load(AtomicBase::RELAXED);
+                intptr const t = top_.get().load(AtomicBase::RELAXED);
+                return b > t ? static_cast<int32>(b - t) : 0;
+            }
+
+            /**
+             * Tests if this deque has elements.
+             *
+             * @return true if this deque does not contain any elements.
+             */
+            bool isEmpty() const
+            {
+                return getLength() == 0 ? true : false;
+            }
+
+        private:
+
+            /**
+             * Ring buffer of elements.
+             */
+            class Array : public library::Object<A>, private Allocation<A>
+            {
+                typedef library::Object<A> ParentSpec1;
+                typedef library::Allocation<A> ParentSpec2;
+
+            public:
+
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity - a number of elements, which is a power of two.
+                 * @param retired  - a replaced buffer, or NULL.
+                 */
+                Array(int32 const capacity, Array* const retired) : ParentSpec1(), ParentSpec2(),
+                    elements_ (NULL),
+                    mask_     (capacity - 1),
+                    retired_  (retired){
+                    const bool isConstructed = construct(capacity);
+                    this->setConstructed( isConstructed );
+                }
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~Array()
+                {
+                    if(elements_ != NULL)
+                    {
+                        ParentSpec2::free(elements_);
+                    }
+                }
+
+                /**
+                 * Returns an element.
+                 *
+                 * @param index - an index of the deque.
+                 * @return the element.
+                 */
+                T get(intptr const index) const
+                {
+                    return elements_[index & mask_];
+                }
+
+                /**
+                 * Puts an element.
+                 *
+                 * @param index   - an index of the deque.
+                 * @param element - the element.
+                 */
+                void put(intptr const index, const T& element)
+                {
+                    elements_[index & mask_] = element;
+                }
+
+                /**
+                 * Returns a number of elements.
+                 *
+                 * @return the capacity.
+                 */
+                intptr getCapacity() const
+                {
+                    return mask_ + 1;
+                }
+
+                /**
+                 * Returns the replaced buffer.
+                 *
+                 * @return the buffer, or NULL.
+                 */
+                Array* getRetired() const
+                {
+                    return retired_;
+                }
+
+            private:
+
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity - a number of elements.
+                 * @return true if object has been constructed successfully.
+                 */
+                bool construct(int32 const capacity)
+                {
+                    bool res;
+                    if( not this->isConstructed_ || capacity <= 0 || (capacity & mask_) != 0 )
+                    {
+                        res = false;
+                    }
+                    else if( static_cast<size_t>(capacity) > ~static_cast<size_t>(0) / sizeof(T) )
+                    {
+                        res = false;
+                    }
+                    else
+                    {
+                        void* const addr = ParentSpec2::allocate( static_cast<size_t>(capacity) * sizeof(T) );
+                        elements_ = reinterpret_cast<T*>(addr);
+                        res = elements_ != NULL ? true : false;
+                    }
+                    return res;
+                }
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj - reference to source object.
+                 */
+                Array(const Array& obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj - reference to source object.
+                 * @return reference to this object.
+                 */
+                Array& operator=(const Array& obj);
+
+                /**
+                 * The elements allocated by the allocator.
+                 */
+                T* elements_;
+
+                /**
+                 * Mask of an index of an element.
+                 */
+                intptr mask_;
+
+                /**
+                 * The replaced buffer.
+                 */
+                Array* retired_;
+
+            };
+
+            /**
+             * Constructor.
+             *
+             * @param capacity - an initial number of elements.
+             * @return true if object has been constructed successfully.
+             */
+            bool construct(int32 const capacity)
+            {
+                bool res;
+                if( not this->isConstructed_ )
+                {
+                    res = false;
+                }
+                else
+                {
+                    Array* const array = create(capacity, NULL);
+                    array_.store(array, AtomicBase::RELAXED);
+                    res = array != NULL ? true : false;
+                }
+                return res;
+            }
+
+            /**
+             * Replaces a buffer by a buffer of double capacity.
+             *
+             * @param array - the current buffer.
+             * @param t     - the top index.
+             * @param b     - the bottom index.
+             * @return the new buffer, or NULL if no memory.
+             */
+            Array* grow(Array* const array, intptr const t, intptr const b)
+            {
+                Array* const res = create(static_cast<int32>(array->getCapacity() * 2), array);
+                if(res != NULL)
+                {
+                    for(intptr i=t; i<b; i++)
+                    {
+                        res->put(i, array->get(i));
+                    }
+                    // The elements must be stored before the buffer is published for thieves
+                    array_.store(res, AtomicBase::RELEASE);
+                }
+                return res;
+            }
+
+            /**
+             * Creates a buffer.
+             *
+             * @param capacity - a number of elements.
+             * @param retired  - a replaced buffer, or NULL.
+             * @return the buffer, or NULL if an error has been occurred.
+             */
+            static Array* create(int32 const capacity, Array* const retired)
+            {
+                Array* res = new Array(capacity, retired);
+                if( res != NULL && not res->isConstructed() )
+                {
+                    delete res;
+                    res = NULL;
+                }
+                return res;
+            }
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj - reference to source object.
+             */
+            WorkStealingDeque(const WorkStealingDeque& obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj - reference to source object.
+             * @return reference to this object.
+             */
+            WorkStealingDeque& operator=(const WorkStealingDeque& obj);
+
+            /**
+             * Index of the top element.
+             */
+            CacheAligned< Atomic<intptr> > top_;
+
+            /**
+             * Index following the bottom element.
+             */
+            CacheAligned< Atomic<intptr> > bottom_;
+
+            /**
+             * The current buffer.
+             */
+            Atomic<Array*> array_;
+
+        };
+    }
+}
+#endif // LIBRARY_WORK_STEALING_DEQUE_HPP_
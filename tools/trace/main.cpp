@@ -0,0 +1,279 @@
+/**
+ * Decoder of trace dumps.
+ *
+ * The tool reads a dump of a trace region written on a target, and prints
+ * events of all the cores as one timeline sorted by time, for example:
+ *
+ * trace-decoder trace.bin
+ *
+ * The time of events is printed in ticks of the target cycle timer relatively
+ * to the first event. The dump has to be written by a processor of the same
+ * byte order as the host.
+ *
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2019, Sergey Baigudin, Baigudin Software
+ * @license   http://embedded.team/license/
+ */
+#include "library.TraceFormat.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace local
+{
+    namespace trace
+    {
+        typedef library::TraceFormat TraceFormat;
+
+        /**
+         * Event of a core.
+         */
+        struct Record
+        {
+            /**
+             * Index of the core.
+             */
+            uint32 core;
+
+            /**
+             * The event.
+             */
+            TraceFormat::Event event;
+
+        };
+
+        /**
+         * Compares records by time.
+         *
+         * @param obj1 - the first record.
+         * @param obj2 - the second record.
+         * @return a negative value, zero or a positive value if the first record is earlier, simultaneous or later.
+         */
+        static int compare(const void* const obj1, const void* const obj2)
+        {
+            const Record* const rec1 = reinterpret_cast<const Record*>(obj1);
+            const Record* const rec2 = reinterpret_cast<const Record*>(obj2);
+            int res;
+            if(rec1->event.time != rec2->event.time)
+            {
+                res = rec1->event.time < rec2->event.time ? -1 : 1;
+            }
+            else if(rec1->core != rec2->core)
+            {
+                res = rec1->core < rec2->core ? -1 : 1;
+            }
+            else
+            {
+                res = rec1->event.sequence < rec2->event.sequence ? -1 : 1;
+            }
+            return res;
+        }
+
+        /**
+         * Prints an event.
+         *
+         * @param rec   - a record of the event.
+         * @param start - time of the first event.
+         */
+        static void print(const Record& rec, uint64 const start)
+        {
+            const TraceFormat::Event& event = rec.event;
+            unsigned long long const time = static_cast<unsigned long long>(event.time - start);
+            unsigned long long const arg0 = static_cast<unsigned long long>(event.args[0]);
+            unsigned long long const arg1 = static_cast<unsigned long long>(event.args[1]);
+            ::printf("%14llu  %3u  ", time, static_cast<unsigned>(rec.core));
+            switch(event.id)
+            {
+                case TraceFormat::HEAP_ALLOCATE:
+                    ::printf("HEAP_ALLOCATE   size=%llu address=0x%llx\n", arg0, arg1);
+                    break;
+
+                case TraceFormat::HEAP_FREE:
+                    ::printf("HEAP_FREE       address=0x%llx\n", arg0);
+                    break;
+
+                case TraceFormat::TOGGLE_DISABLE:
+                    ::printf("TOGGLE_DISABLE  status=%llu\n", arg0);
+                    break;
+
+                case TraceFormat::TOGGLE_ENABLE:
+                    ::printf("TOGGLE_ENABLE   status=%llu\n", arg0);
+                    break;
+
+                case TraceFormat::LIST_ADD:
+                    ::printf("LIST_ADD        index=%lld length=%lld\n", static_cast<long long>(arg0), static_cast<long long>(arg1));
+                    break;
+
+                case TraceFormat::LIST_REMOVE:
+                    ::printf("LIST_REMOVE     length=%lld\n", static_cast<long long>(arg0));
+                    break;
+
+                default:
+                    if(event.id >= TraceFormat::USER)
+                    {
+                        ::printf("USER+%-10u  0x%llx 0x%llx\n", static_cast<unsigned>(event.id - TraceFormat::USER), arg0, arg1);
+                    }
+                    else
+                    {
+                        ::printf("UNKNOWN %-7u  0x%llx 0x%llx\n", static_cast<unsigned>(event.id), arg0, arg1);
+                    }
+                    break;
+            }
+        }
+
+        /**
+         * Reads a file.
+         *
+         * @param name - a file name.
+         * @param size - a variable for the file size.
+         * @return the file content which has to be freed, or NULL if an error has been occurred.
+         */
+        static uint8* read(const char* const name, size_t& size)
+        {
+            uint8* res = NULL;
+            FILE* const file = ::fopen(name, "rb");
+            if(file != NULL)
+            {
+                if( ::fseek(file, 0, SEEK_END) == 0 )
+                {
+                    long const length = ::ftell(file);
+                    if( length > 0 && ::fseek(file, 0, SEEK_SET) == 0 )
+                    {
+                        size = static_cast<size_t>(length);
+                        res = reinterpret_cast<uint8*>( ::malloc(size) );
+                        if( res != NULL && ::fread(res, 1, size, file) != size )
+                        {
+                            ::free(res);
+                            res = NULL;
+                        }
+                    }
+                }
+                static_cast<void>( ::fclose(file) );
+            }
+            return res;
+        }
+
+        /**
+         * Returns an event of a ring.
+         *
+         * @param ring   - the ring of a dump.
+         * @param header - the header of the dump.
+         * @param index  - a number of the event.
+         * @return the event kept in the slot of the number.
+         */
+        static TraceFormat::Event getEvent(const uint8* const ring, const TraceFormat::Header& header, uint32 const index)
+        {
+            TraceFormat::Event res;
+            uint32 const slot = index & (header.events - 1U);
+            ::memcpy(&res, &ring[ sizeof(TraceFormat::Ring) + static_cast<size_t>(slot) * header.eventSize ], sizeof(res));
+            return res;
+        }
+
+        /**
+         * Decodes a dump.
+         *
+         * @param data - the dump.
+         * @param size - size of the dump in byte.
+         * @return zero, or a non-zero value if the dump is not a trace.
+         */
+        static int decode(const uint8* const data, size_t const size)
+        {
+            TraceFormat::Header header;
+            if(size < sizeof(header))
+            {
+                ::fprintf(stderr, "The dump is too short\n");
+                return 1;
+            }
+            ::memcpy(&header, data, sizeof(header));
+            if(header.magic != TraceFormat::MAGIC || header.version != TraceFormat::VERSION)
+            {
+                ::fprintf(stderr, "The dump is not a trace of version %u\n", static_cast<unsigned>(TraceFormat::VERSION));
+                return 1;
+            }
+            size_t const expected = sizeof(header) + static_cast<size_t>(header.cores) * header.ringSize;
+            if(header.eventSize != sizeof(TraceFormat::Event) || header.events == 0 || ( header.events & (header.events - 1U) ) != 0
+            || header.ringSize < sizeof(TraceFormat::Ring) + static_cast<size_t>(header.events) * header.eventSize || size < expected )
+            {
+                ::fprintf(stderr, "The trace header is broken\n");
+                return 1;
+            }
+            Record* const records = reinterpret_cast<Record*>( ::malloc( static_cast<size_t>(header.cores) * header.events * sizeof(Record) ) );
+            if(records == NULL)
+            {
+                ::fprintf(stderr, "No memory\n");
+                return 1;
+            }
+            size_t count = 0;
+            unsigned long long lost = 0;
+            for(uint32 core=0; core<header.cores; core++)
+            {
+                const uint8* const ring = &data[ sizeof(header) + static_cast<size_t>(core) * header.ringSize ];
+                TraceFormat::Ring head;
+                ::memcpy(&head, ring, sizeof(head));
+                // Numbers of the events kept by the ring, which is full if the number of written events has wrapped around
+                uint32 const last = head.head;
+                uint32 first = last - header.events;
+                if( last < header.events && getEvent(ring, header, first).sequence != TraceFormat::getSequence(first) )
+                {
+                    first = 0;
+                }
+                for(uint32 i=first; i!=last; i++)
+                {
+                    TraceFormat::Event const event = getEvent(ring, header, i);
+                    // The event is being written or has been overwritten by a newer one
+                    if( event.sequence != TraceFormat::getSequence(i) )
+                    {
+                        lost++;
+                        continue;
+                    }
+                    records[count].core = core;
+                    records[count].event = event;
+                    count++;
+                }
+                lost += first;
+            }
+            ::qsort(records, count, sizeof(Record), compare);
+            ::printf("%14s  %3s  %s\n", "TIME", "CPU", "EVENT");
+            for(size_t i=0; i<count; i++)
+            {
+                print(records[i], records[0].event.time);
+            }
+            ::printf("# %llu events, %llu overwritten or incomplete\n", static_cast<unsigned long long>(count), lost);
+            ::free(records);
+            return 0;
+        }
+    }
+}
+
+/**
+ * The main function.
+ *
+ * @param argc - number of arguments.
+ * @param argv - the arguments.
+ * @return error code or zero.
+ */
+int main(int argc, char** argv)
+{
+    int res;
+    if(argc != 2)
+    {
+        ::fprintf(stderr, "Usage: %s <trace dump>\n", argv[0]);
+        res = 2;
+    }
+    else
+    {
+        size_t size = 0;
+        ::local::uint8* const data = ::local::trace::read(argv[1], size);
+        if(data == NULL)
+        {
+            ::fprintf(stderr, "Cannot read %s\n", argv[1]);
+            res = 1;
+        }
+        else
+        {
+            res = ::local::trace::decode(data, size);
+            ::free(data);
+        }
+    }
+    return res;
+}